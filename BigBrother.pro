@@ -2,8 +2,32 @@ QT += core gui widgets
 TARGET = BigBrother
 TEMPLATE = app
 
-HEADERS = environment.hpp opencv.hpp MaskDetector.hpp mainwindow.hpp FaceDetector.hpp Face.hpp Report.hpp
-SOURCES = main.cpp mainwindow.cpp MaskDetector.cpp Face.cpp FaceDetector.cpp Report.cpp
+HEADERS = environment.hpp opencv.hpp MaskDetector.hpp mainwindow.hpp FaceDetector.hpp Report.hpp CascadeCache.hpp Startup.hpp ModelRegistry.hpp MaskBackend.hpp OpenCVBackend.hpp TFLiteBackend.hpp OnnxRuntimeBackend.hpp LowerFaceClassifier.hpp FaceQuality.hpp FaceTracker.hpp ProbabilityCache.hpp InferenceScheduler.hpp ProbabilityStore.hpp HistogramWidget.hpp FaceBatch.hpp ViewTransform.hpp
+SOURCES = main.cpp mainwindow.cpp MaskDetector.cpp FaceDetector.cpp Report.cpp CascadeCache.cpp Startup.cpp ModelRegistry.cpp MaskBackend.cpp OpenCVBackend.cpp TFLiteBackend.cpp OnnxRuntimeBackend.cpp LowerFaceClassifier.cpp FaceQuality.cpp FaceTracker.cpp ProbabilityCache.cpp InferenceScheduler.cpp ProbabilityStore.cpp HistogramWidget.cpp FaceBatch.cpp ViewTransform.cpp
 
 CONFIG += link_pkgconfig
-PKGCONFIG += opencv4 tensorflow
+PKGCONFIG += opencv4
+
+# libtensorflow can be left out on small devices that run a frozen or ONNX model through OpenCV, build with: qmake CONFIG+=no_tensorflow
+no_tensorflow {
+    DEFINES += BIGBROTHER_WITHOUT_TENSORFLOW
+} else {
+    HEADERS += TensorPool.hpp TensorFlowBackend.hpp
+    SOURCES += TensorPool.cpp TensorFlowBackend.cpp
+    PKGCONFIG += tensorflow
+}
+
+# optional TensorFlow Lite backend, build with: qmake CONFIG+=tflite
+tflite {
+    DEFINES += BIGBROTHER_WITH_TFLITE
+    LIBS += -ltensorflowlite_c
+}
+
+# optional ONNX Runtime backend, build with: qmake CONFIG+=onnxruntime (add CONFIG+=onnxruntime_dnnl for the oneDNN provider)
+onnxruntime {
+    DEFINES += BIGBROTHER_WITH_ONNXRUNTIME
+    LIBS += -lonnxruntime
+}
+onnxruntime_dnnl {
+    DEFINES += BIGBROTHER_WITH_ONNXRUNTIME_DNNL
+}
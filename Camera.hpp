@@ -13,7 +13,6 @@
 
 #include "environment.hpp"
 
-#include "Face.hpp"
 #include "FaceDetector.hpp"
 
 #endif /* Camera_h */
@@ -0,0 +1,244 @@
+/**
+ * @file CascadeCache.cpp
+ * @brief Comprises the CascadeCache class, which writes a stripped down copy of the Haar cascade behind a checksummed header and reads it on later starts. The cache records the FNV checksum of the XML it was built from, and is rebuilt whenever the XML present no longer matches it
+ * @bug OpenCV can only populate a CascadeClassifier from a FileNode, so the payload is still a (much smaller) cascade document that FileStorage parses, rather than raw classifier structs. The saving is in parsing less text, not in skipping the parse
+ */
+
+/** -- Includes -- **/
+#include "CascadeCache.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string.h>
+
+// bump the version whenever the payload layout changes so old caches are rebuilt
+static const char CACHE_MAGIC[4] = {'B', 'B', 'H', 'C'};
+static const uint32_t CACHE_VERSION = 3;
+
+/**
+ * @brief 64 bit FNV-1a hash, used to match the cache to its XML and to catch a torn or corrupted payload
+ *
+ * @param data Bytes to hash
+ * @param size Number of bytes
+ * @return Hash of the bytes
+ */
+uint64_t CascadeCache::checksum(const char *data, size_t size){
+
+    uint64_t hash = 14695981039346656037ULL;
+
+    for(size_t i = 0; i < size; i++){
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Reads a whole file into memory
+ *
+ * @param location Path of the file
+ * @param contents Filled with the file bytes
+ * @return Whether the file could be read
+ */
+bool CascadeCache::readFile(const string &location, string &contents){
+
+    std::ifstream file(location, std::ios::binary);
+    if(!file.is_open()){
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+
+    return !contents.empty();
+}
+
+/**
+ * @brief Writes a node of the cascade back out as minimal XML, dropping comments, indentation and excess float digits
+ *
+ * @param node Node of the parsed cascade
+ * @param out String the XML is appended to
+ */
+void CascadeCache::writeNode(const FileNode &node, string &out){
+
+    if(node.isMap()){
+        for(FileNodeIterator it = node.begin(); it != node.end(); ++it){
+            FileNode child = *it;
+            out += "<" + child.name() + ">";
+            writeNode(child, out);
+            out += "</" + child.name() + ">";
+        }
+    }else if(node.isSeq()){
+        for(FileNodeIterator it = node.begin(); it != node.end(); ++it){
+            FileNode child = *it;
+            // nested collections need their own element, plain numbers are space separated
+            if(child.isMap() || child.isSeq()){
+                out += "<_>";
+                writeNode(child, out);
+                out += "</_>";
+            }else{
+                writeNode(child, out);
+                out += " ";
+            }
+        }
+    }else if(node.isInt()){
+        out += format("%d", (int)node);
+    }else if(node.isReal()){
+        string real = format("%.9g", (double)node);
+        // keep a decimal point so the value is parsed back as a real
+        if(real.find_first_of(".en") == string::npos){
+            real += ".";
+        }
+        out += real;
+    }else if(node.isString()){
+        out += (string)node;
+    }
+}
+
+/**
+ * @brief Serializes the cascade and writes it behind the header, via a temporary file so a crash never leaves a torn cache
+ *
+ * @param cascade Top level cascade node
+ * @param xml Contents of the source XML, only its size and checksum are stored
+ * @param cacheLocation Where the cache should be written
+ * @return Whether the cache was written
+ */
+bool CascadeCache::writeCache(const FileNode &cascade, const string &xml, const string &cacheLocation){
+
+    string payload = "<?xml version=\"1.0\"?>\n<opencv_storage><" + cascade.name() + " type_id=\"opencv-cascade-classifier\">";
+    writeNode(cascade, payload);
+    payload += "</" + cascade.name() + "></opencv_storage>\n";
+
+    Header header;
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.xmlSize = xml.size();
+    header.xmlChecksum = checksum(xml.data(), xml.size());
+    header.payloadSize = payload.size();
+    header.payloadChecksum = checksum(payload.data(), payload.size());
+
+    string temporaryLocation = cacheLocation + ".tmp";
+
+    std::ofstream file(temporaryLocation, std::ios::binary | std::ios::trunc);
+    if(!file.is_open()){
+        return false;
+    }
+    file.write((const char*)&header, sizeof(header));
+    file.write(payload.data(), payload.size());
+    file.close();
+
+    if(file.fail()){
+        remove(temporaryLocation.c_str());
+        return false;
+    }
+
+    return rename(temporaryLocation.c_str(), cacheLocation.c_str()) == 0;
+}
+
+/**
+ * @brief Reads the header and payload of a cache file, checking the payload against its own checksum
+ *
+ * @param cacheLocation Path of the cache
+ * @param header Filled with the header
+ * @param payload Filled with the payload, read straight into the string FileStorage parses
+ * @return Whether the file is a complete cache of this version
+ */
+bool CascadeCache::readCache(const string &cacheLocation, Header &header, string &payload){
+
+    std::ifstream file(cacheLocation, std::ios::binary | std::ios::ate);
+    if(!file.is_open()){
+        return false;
+    }
+
+    std::streamoff size = file.tellg();
+    if(size < (std::streamoff)sizeof(Header)){
+        return false;
+    }
+
+    file.seekg(0, std::ios::beg);
+    if(!file.read((char*)&header, sizeof(header))){
+        return false;
+    }
+
+    if(memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0
+        || header.version != CACHE_VERSION
+        || header.payloadSize != (uint64_t)size - sizeof(Header)){
+        return false;
+    }
+
+    payload.resize(header.payloadSize);
+    if(!file.read(&payload[0], payload.size())){
+        return false;
+    }
+
+    return checksum(payload.data(), payload.size()) == header.payloadChecksum;
+}
+
+/**
+ * @brief Loads the cascade from the cache when it matches the XML, otherwise parses the XML and refreshes the cache
+ *
+ * If the XML is missing the cache is still used as long as its own payload checksum holds, which keeps kiosks running on a stripped install
+ *
+ * @param cacheLocation Path of the cache
+ * @param xmlLocation Path of the source cascade XML
+ * @param cascade Classifier to populate
+ * @return Whether the classifier was loaded from either source
+ */
+bool CascadeCache::load(const string &cacheLocation, const string &xmlLocation, CascadeClassifier &cascade){
+
+    string xml;
+    bool haveXml = readFile(xmlLocation, xml);
+
+    Header header;
+    string payload;
+
+    if(readCache(cacheLocation, header, payload)){
+
+        bool matches = !haveXml || (header.xmlSize == xml.size() && header.xmlChecksum == checksum(xml.data(), xml.size()));
+
+        if(matches){
+            FileStorage fs(payload, FileStorage::READ | FileStorage::MEMORY);
+            if(fs.isOpened() && cascade.read(fs.getFirstTopLevelNode())){
+                return true;
+            }
+        }
+    }
+
+    // the cache is missing or stale so parse the XML and refresh the cache for next time
+    if(!haveXml){
+        return false;
+    }
+
+    FileStorage fs(xml, FileStorage::READ | FileStorage::MEMORY);
+    if(!fs.isOpened() || !cascade.read(fs.getFirstTopLevelNode())){
+        return false;
+    }
+
+    writeCache(fs.getFirstTopLevelNode(), xml, cacheLocation);
+
+    return true;
+}
+
+/**
+ * @brief Rebuilds the cache from the XML, used by the command line tool when preparing an install
+ *
+ * @param xmlLocation Path of the source cascade XML
+ * @param cacheLocation Where the cache should be written
+ * @return Whether the cache was written
+ */
+bool CascadeCache::build(const string &xmlLocation, const string &cacheLocation){
+
+    string xml;
+    if(!readFile(xmlLocation, xml)){
+        return false;
+    }
+
+    FileStorage fs(xml, FileStorage::READ | FileStorage::MEMORY);
+    if(!fs.isOpened() || fs.getFirstTopLevelNode().empty()){
+        return false;
+    }
+
+    return writeCache(fs.getFirstTopLevelNode(), xml, cacheLocation);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file CascadeCache.hpp
+ * @brief Header file for the CascadeCache class, which stores a compact, pre-validated copy of the Haar cascade so startup does not re-parse the full XML
+ */
+
+#ifndef CascadeCache_hpp
+#define CascadeCache_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+
+#include "opencv.hpp"
+
+using namespace cv;
+using namespace std;
+
+class CascadeCache
+{
+
+private:
+    // file layout written in front of the compact cascade payload
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        // size and checksum of the XML the cache was built from
+        uint64_t xmlSize;
+        uint64_t xmlChecksum;
+        uint64_t payloadSize;
+        uint64_t payloadChecksum;
+    };
+
+    // helpers to hash and serialize the cascade
+    static uint64_t checksum(const char *data, size_t size);
+    static bool readFile(const string &location, string &contents);
+    static void writeNode(const FileNode &node, string &out);
+    static bool writeCache(const FileNode &cascade, const string &xml, const string &cacheLocation);
+    static bool readCache(const string &cacheLocation, Header &header, string &payload);
+
+public:
+    // try the cache first, fall back to the XML and refresh the cache
+    static bool load(const string &cacheLocation, const string &xmlLocation, CascadeClassifier &cascade);
+    // unconditionally rebuild the cache from the XML
+    static bool build(const string &xmlLocation, const string &cacheLocation);
+
+};
+
+#endif /* CascadeCache_hpp */
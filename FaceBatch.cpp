@@ -0,0 +1,121 @@
+/**
+ * @file FaceBatch.cpp
+ * @brief Comprises the FaceBatch class. Detection, tracking, scheduling, inference, drawing and the compliance count all work on the same arrays, which only grow when a frame holds more faces than any before it
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "FaceBatch.hpp"
+
+/**
+ * @brief Constructor for FaceBatch, reserves every array up front
+ *
+ * @param capacity Faces per frame that fit without reallocating
+ */
+FaceBatch::FaceBatch(size_t capacity){
+
+    this->count = 0;
+
+    this->areas.reserve(capacity);
+    this->displayAreas.reserve(capacity);
+    this->tracks.reserve(capacity);
+    this->probabilities.reserve(capacity);
+    this->decisions.reserve(capacity);
+    this->states.reserve(capacity);
+    this->order.reserve(capacity);
+
+}
+
+/** @brief destroys FaceBatch.
+ *
+ *  this just destroys the FaceBatch
+ *
+ */
+FaceBatch::~FaceBatch(){
+
+}
+
+/**
+ * @brief Clears the previous frame and fills in the boxes of this one, keeping the memory of every array
+ *
+ * @param detected Boxes at detection scale
+ * @param displayScale Factor from detection scale to the frame the boxes are drawn on
+ */
+void FaceBatch::reset(const vector<Rect> &detected, double displayScale){
+
+    this->count = detected.size();
+
+    this->areas.assign(detected.begin(), detected.end());
+    this->displayAreas.resize(this->count);
+    this->tracks.resize(this->count);
+    this->probabilities.assign(this->count, 0.f);
+    this->decisions.assign(this->count, 0);
+    this->states.assign(this->count, FACE_PENDING);
+
+    for(size_t i = 0; i < this->count; i++){
+        const Rect &area = detected[i];
+        Point topLeft(cvRound(area.x * displayScale), cvRound(area.y * displayScale));
+        Point bottomRight(cvRound((area.x + area.width - 1) * displayScale), cvRound((area.y + area.height - 1) * displayScale));
+        this->displayAreas[i] = Rect(topLeft, bottomRight);
+    }
+
+}
+
+size_t FaceBatch::size(){
+    return this->count;
+}
+
+/**
+ * @brief Stores the result a face ends the frame with
+ */
+void FaceBatch::setResult(size_t face, float probability, bool hasMask, FaceState state){
+
+    this->probabilities[face] = probability;
+    this->decisions[face] = hasMask;
+    this->states[face] = state;
+
+}
+
+void FaceBatch::setState(size_t face, FaceState state){
+    this->states[face] = state;
+}
+
+const vector<Rect> &FaceBatch::getAreas(){
+    return this->areas;
+}
+
+vector<int> &FaceBatch::getTracks(){
+    return this->tracks;
+}
+
+vector<size_t> &FaceBatch::getOrder(){
+    return this->order;
+}
+
+Rect FaceBatch::getArea(size_t face){
+    return this->areas[face];
+}
+
+Rect FaceBatch::getDisplayArea(size_t face){
+    return this->displayAreas[face];
+}
+
+int FaceBatch::getTrack(size_t face){
+    return this->tracks[face];
+}
+
+float FaceBatch::getProbability(size_t face){
+    return this->probabilities[face];
+}
+
+bool FaceBatch::getDecision(size_t face){
+    return this->decisions[face];
+}
+
+FaceState FaceBatch::getState(size_t face){
+    return (FaceState)this->states[face];
+}
+
+bool FaceBatch::isCounted(size_t face){
+    return this->states[face] == FACE_SCORED || this->states[face] == FACE_CARRIED;
+}
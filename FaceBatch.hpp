@@ -0,0 +1,78 @@
+/**
+ * @file FaceBatch.hpp
+ * @brief Header file for the FaceBatch class, which holds everything known about the faces of one frame in parallel arrays that are reused from frame to frame
+ */
+
+#ifndef FaceBatch_hpp
+#define FaceBatch_hpp
+
+#include <stdio.h>
+#include <vector>
+
+#include "opencv.hpp"
+#include "environment.hpp"
+#include "MaskDetector.hpp"
+
+using namespace cv;
+using namespace std;
+
+// what happened to a face this frame
+enum FaceState {
+    // the model is still loading
+    FACE_PENDING,
+    // classified this frame
+    FACE_SCORED,
+    // kept its track's earlier result
+    FACE_CARRIED,
+    // new face that did not fit the frame budget
+    FACE_QUEUED,
+    // new face whose crop was too poor to classify
+    FACE_LOW_QUALITY
+};
+
+class FaceBatch
+{
+
+private:
+    size_t count;
+
+    // index i of every array is the same face
+    vector<Rect> areas;
+    vector<Rect> displayAreas;
+    vector<int> tracks;
+    vector<float> probabilities;
+    vector<unsigned char> decisions;
+    vector<unsigned char> states;
+    // order the scheduler wants the faces scored in
+    vector<size_t> order;
+
+public:
+    // constructor, room for capacity faces before any array has to grow
+    FaceBatch(size_t capacity = MAX_FACES_PER_FRAME);
+    // destructor
+    ~FaceBatch();
+
+    // starts a new frame with the detected boxes, scaled by displayScale for drawing
+    void reset(const vector<Rect> &detected, double displayScale);
+    size_t size();
+
+    void setResult(size_t face, float probability, bool hasMask, FaceState state);
+    void setState(size_t face, FaceState state);
+
+    // arrays for the stages that fill or read a whole column at once
+    const vector<Rect> &getAreas();
+    vector<int> &getTracks();
+    vector<size_t> &getOrder();
+
+    Rect getArea(size_t face);
+    Rect getDisplayArea(size_t face);
+    int getTrack(size_t face);
+    float getProbability(size_t face);
+    bool getDecision(size_t face);
+    FaceState getState(size_t face);
+    // faces that count towards compliance this frame
+    bool isCounted(size_t face);
+
+};
+
+#endif /* FaceBatch_hpp */
@@ -5,6 +5,7 @@
 
 /** -- Includes -- **/
 #include "FaceDetector.hpp"
+#include "CascadeCache.hpp"
 
 FaceDetector* FaceDetector::instance = nullptr;
 
@@ -13,7 +14,10 @@ FaceDetector* FaceDetector::instance = nullptr;
  */ 
 FaceDetector::FaceDetector(){
 
-    faceCascade.load(FACE_MODEL_LOCATION);
+    // prefer the compact cache, it is rebuilt from the XML whenever the XML checksum does not match
+    if(!CascadeCache::load(FACE_CACHE_LOCATION, FACE_MODEL_LOCATION, faceCascade)){
+        faceCascade.load(FACE_MODEL_LOCATION);
+    }
 }
 
 /** @brief destroys FaceDetector.
@@ -0,0 +1,55 @@
+/**
+ * @file FaceQuality.cpp
+ * @brief Comprises the FaceQuality class. Blurred, tiny and badly exposed crops give the mask model nothing to go on, so they are caught here for a fraction of the cost of an inference
+ * @bug Occlusion by hands or other people is not measured, only its side effects on sharpness and exposure
+ */
+
+/** -- Includes -- **/
+#include "FaceQuality.hpp"
+
+#include <algorithm>
+
+// larger crops are shrunk to this before measuring sharpness, FACE_MIN_SHARPNESS is the threshold at this size
+static const int QUALITY_SIZE = 64;
+
+/**
+ * @brief Measures sharpness, exposure and size of a face crop
+ *
+ * @param crop Face of BGR pixels at detection scale
+ * @return The measurements and whether the crop is worth running the model on
+ */
+QualityScore FaceQuality::assess(const Mat &crop){
+
+    QualityScore score;
+    score.size = std::min(crop.cols, crop.rows);
+
+    Mat grey;
+    cvtColor(crop, grey, COLOR_BGR2GRAY);
+
+    // only ever shrink, upscaling would smooth a small but sharp face and fail it as blurred
+    if(score.size > QUALITY_SIZE){
+        double scale = (double)QUALITY_SIZE / score.size;
+        resize(grey, grey, Size(), scale, scale, INTER_AREA);
+    }
+    int measuredSize = std::min(grey.cols, grey.rows);
+
+    Mat laplacian;
+    Laplacian(grey, laplacian, CV_32F);
+
+    Scalar mean;
+    Scalar deviation;
+    meanStdDev(laplacian, mean, deviation);
+
+    score.sharpness = deviation[0] * deviation[0];
+    score.brightness = cv::mean(grey)[0];
+
+    // edges take up a larger share of a smaller crop, so a sharp small face scores higher and the threshold rises with it
+    double minSharpness = FACE_MIN_SHARPNESS * QUALITY_SIZE / std::max(1, measuredSize);
+
+    score.usable = score.size >= FACE_MIN_SIZE
+        && score.sharpness >= minSharpness
+        && score.brightness >= FACE_MIN_BRIGHTNESS
+        && score.brightness <= FACE_MAX_BRIGHTNESS;
+
+    return score;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file FaceQuality.hpp
+ * @brief Header file for the FaceQuality class, which scores how usable a face crop is before it is sent to the mask model
+ */
+
+#ifndef FaceQuality_hpp
+#define FaceQuality_hpp
+
+#include <stdio.h>
+
+#include "opencv.hpp"
+#include "environment.hpp"
+
+using namespace cv;
+
+// cheap measurements of one crop and whether they clear the FACE_MIN_* / FACE_MAX_* thresholds
+struct QualityScore {
+    // variance of the Laplacian at the crop's own size (shrunk if large), low for motion blur and out of focus faces
+    double sharpness;
+    // mean grey level, 0-255
+    double brightness;
+    // shorter side of the box in detection pixels
+    int size;
+    bool usable;
+};
+
+class FaceQuality
+{
+
+public:
+    // score a crop cut from the frame the faces were detected on
+    static QualityScore assess(const Mat &crop);
+
+};
+
+#endif /* FaceQuality_hpp */
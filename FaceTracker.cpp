@@ -0,0 +1,157 @@
+/**
+ * @file FaceTracker.cpp
+ * @brief Comprises the FaceTracker class. Boxes are matched greedily to the track they overlap most, which is enough at camera frame rates where faces move a few pixels between frames
+ * @bug Two people crossing can swap tracks for a frame
+ */
+
+/** -- Includes -- **/
+#include "FaceTracker.hpp"
+
+#include <algorithm>
+
+FaceTracker* FaceTracker::instance = nullptr;
+
+/**
+ * @brief Overlap of two boxes as intersection over union
+ */
+static float overlap(const Rect &a, const Rect &b){
+
+    int intersection = (a & b).area();
+    int unionArea = a.area() + b.area() - intersection;
+
+    return unionArea > 0 ? (float)intersection / unionArea : 0.f;
+}
+
+/**
+ * @brief Constructor for FaceTracker, starts with no tracks
+ */
+FaceTracker::FaceTracker(){
+
+    this->nextId = 0;
+
+}
+
+/** @brief destroys FaceTracker.
+ *
+ *  this just destroys the FaceTracker
+ *
+ */
+FaceTracker::~FaceTracker(){
+
+}
+
+FaceTracker* FaceTracker::getInstance(){
+
+    if(!FaceTracker::instance){
+        FaceTracker::instance = new FaceTracker();
+    }
+
+    return FaceTracker::instance;
+}
+
+FaceTracker::Track *FaceTracker::find(int id){
+
+    for(Track &track : this->tracks){
+        if(track.id == id){
+            return &track;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Matches each box to the unmatched track it overlaps most, starts tracks for the rest and drops tracks missing for TRACK_MAX_MISSED frames
+ *
+ * @param faces Boxes found in this frame
+ * @param ids Set to the track id of each box, in the same order
+ */
+void FaceTracker::update(const vector<Rect> &faces, vector<int> &ids){
+
+    ids.assign(faces.size(), -1);
+    vector<unsigned char> &matched = this->matched;
+    matched.assign(this->tracks.size(), 0);
+
+    for(size_t i = 0; i < faces.size(); i++){
+
+        int best = -1;
+        float bestOverlap = TRACK_MIN_OVERLAP;
+
+        for(size_t t = 0; t < this->tracks.size(); t++){
+            float value = overlap(faces[i], this->tracks[t].area);
+            if(!matched[t] && value >= bestOverlap){
+                best = (int)t;
+                bestOverlap = value;
+            }
+        }
+
+        if(best >= 0){
+            matched[best] = 1;
+            ids[i] = this->tracks[best].id;
+        }
+    }
+
+    for(size_t t = 0; t < this->tracks.size(); t++){
+        this->tracks[t].missed = matched[t] ? 0 : this->tracks[t].missed + 1;
+        this->tracks[t].age++;
+    }
+
+    for(size_t i = 0; i < faces.size(); i++){
+        if(ids[i] < 0){
+            Track track = {this->nextId++, faces[i], 0, 0, false, MaskResult()};
+            this->tracks.push_back(track);
+            ids[i] = track.id;
+        }else{
+            find(ids[i])->area = faces[i];
+        }
+    }
+
+    auto expired = [](const Track &track){
+        return track.missed > TRACK_MAX_MISSED;
+    };
+    this->tracks.erase(std::remove_if(this->tracks.begin(), this->tracks.end(), expired), this->tracks.end());
+
+}
+
+/**
+ * @brief Stores the model's result for a track, used for the frames where its crop is not good enough
+ */
+void FaceTracker::setResult(int id, MaskResult result){
+
+    Track *track = find(id);
+    if(track){
+        track->hasResult = true;
+        track->result = result;
+        track->age = 0;
+    }
+
+}
+
+bool FaceTracker::hasResult(int id){
+
+    Track *track = find(id);
+
+    return track && track->hasResult;
+}
+
+/**
+ * @return The track's last result, a default result when it has none
+ */
+MaskResult FaceTracker::getResult(int id){
+
+    Track *track = find(id);
+
+    return track ? track->result : MaskResult();
+}
+
+int FaceTracker::getResultAge(int id){
+
+    Track *track = find(id);
+
+    return track && track->hasResult ? track->age : -1;
+}
+
+int FaceTracker::getTrackCount(){
+
+    return (int)this->tracks.size();
+}
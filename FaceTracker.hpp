@@ -0,0 +1,65 @@
+/**
+ * @file FaceTracker.hpp
+ * @brief Header file for the FaceTracker class, which follows faces from frame to frame by box overlap so a face keeps its last good result
+ */
+
+#ifndef FaceTracker_hpp
+#define FaceTracker_hpp
+
+#include <stdio.h>
+#include <vector>
+
+#include "opencv.hpp"
+#include "environment.hpp"
+#include "MaskDetector.hpp"
+
+using namespace cv;
+using namespace std;
+
+class FaceTracker
+{
+
+private:
+    // one face followed across frames
+    struct Track {
+        int id;
+        Rect area;
+        // frames since the track was last matched
+        int missed;
+        // frames since the track last got a result from the model
+        int age;
+        bool hasResult;
+        MaskResult result;
+    };
+
+    vector<Track> tracks;
+    int nextId;
+    // which tracks a box was matched to this frame, kept to avoid reallocating
+    vector<unsigned char> matched;
+
+    Track *find(int id);
+
+public:
+    static FaceTracker *instance;
+
+    // constructor
+    FaceTracker();
+    // destructor
+    ~FaceTracker();
+
+    static FaceTracker *getInstance();
+
+    // match this frame's boxes to the tracks, fills in the track id of each box
+    void update(const vector<Rect> &faces, vector<int> &ids);
+
+    void setResult(int id, MaskResult result);
+    bool hasResult(int id);
+    MaskResult getResult(int id);
+    // frames since the track last got a result, -1 if it never did
+    int getResultAge(int id);
+
+    int getTrackCount();
+
+};
+
+#endif /* FaceTracker_hpp */
@@ -0,0 +1,71 @@
+/**
+ * @file HistogramWidget.cpp
+ * @brief Comprises the HistogramWidget class. The bars are grouped from the same probability store compliance is counted from on every repaint, and split at the current sensitivity, so moving it recolours the whole session
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "HistogramWidget.hpp"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Constructor for HistogramWidget
+ *
+ * @param store Probabilities to draw, owned by the caller
+ * @param parent Qt parent
+ */
+HistogramWidget::HistogramWidget(ProbabilityStore *store, QWidget *parent) : QWidget(parent){
+
+    this->store = store;
+    this->sensitivity = 0.f;
+
+    setMinimumSize(160, 60);
+    setToolTip("Mask probability of every counted face, green where it counts as a mask at the current sensitivity");
+
+}
+
+/**
+ * @brief Moves the sensitivity marker
+ */
+void HistogramWidget::setSensitivity(float sensitivity){
+
+    this->sensitivity = sensitivity;
+    update();
+
+}
+
+void HistogramWidget::paintEvent(QPaintEvent *){
+
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(245, 245, 245));
+
+    int bins = MASK_HISTOGRAM_BINS;
+
+    std::vector<long> masked;
+    std::vector<long> unmasked;
+    this->store->histogram(bins, this->sensitivity, masked, unmasked);
+
+    long tallest = 1;
+    for(int i = 0; i < bins; i++){
+        tallest = std::max(tallest, masked[i] + unmasked[i]);
+    }
+
+    double barWidth = (double)width() / bins;
+
+    for(int i = 0; i < bins; i++){
+        int x = (int)(i * barWidth);
+        int w = std::max(1, (int)((i + 1) * barWidth) - x - 1);
+        int withoutHeight = (int)((double)unmasked[i] / tallest * height());
+        int withHeight = (int)((double)masked[i] / tallest * height());
+
+        painter.fillRect(x, height() - withoutHeight, w, withoutHeight, QColor(200, 40, 40));
+        painter.fillRect(x, height() - withoutHeight - withHeight, w, withHeight, QColor(40, 160, 40));
+    }
+
+    int marker = (int)(this->sensitivity * width());
+    painter.setPen(QPen(Qt::black, 2));
+    painter.drawLine(marker, 0, marker, height());
+
+}
@@ -0,0 +1,34 @@
+/**
+ * @file HistogramWidget.hpp
+ * @brief Header file for the HistogramWidget class, which draws the mask probability histogram with the current sensitivity marked on it
+ */
+
+#ifndef HistogramWidget_hpp
+#define HistogramWidget_hpp
+
+#include <QWidget>
+#include <QPainter>
+#include <QPaintEvent>
+
+#include "ProbabilityStore.hpp"
+
+class HistogramWidget : public QWidget
+{
+
+private:
+    ProbabilityStore *store;
+    float sensitivity;
+
+protected:
+    // stacked bars, green for faces that count as masked at the current sensitivity and red for the rest
+    void paintEvent(QPaintEvent *event) override;
+
+public:
+    // constructor
+    HistogramWidget(ProbabilityStore *store, QWidget *parent = nullptr);
+
+    void setSensitivity(float sensitivity);
+
+};
+
+#endif /* HistogramWidget_hpp */
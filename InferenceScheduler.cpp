@@ -0,0 +1,141 @@
+/**
+ * @file InferenceScheduler.cpp
+ * @brief Comprises the InferenceScheduler class. Faces are scored in priority order until the next one would overrun the frame budget, so a crowded lobby costs the same per frame as an empty one and the rest of the faces keep their tracked results
+ * @bug The first face of a frame is always scored, so a budget below the cost of one face is exceeded by that face
+ */
+
+/** -- Includes -- **/
+#include "InferenceScheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdlib.h>
+
+InferenceScheduler* InferenceScheduler::instance = nullptr;
+
+/**
+ * @brief Constructor for InferenceScheduler, the budget comes from MASK_FRAME_BUDGET_MS or BIGBROTHER_FRAME_BUDGET_MS
+ */
+InferenceScheduler::InferenceScheduler(){
+
+    const char *budget = getenv("BIGBROTHER_FRAME_BUDGET_MS");
+
+    this->budgetMs = budget && *budget ? atof(budget) : MASK_FRAME_BUDGET_MS;
+    this->faceCostMs = 0.0;
+    this->frameStart = std::chrono::steady_clock::now();
+    this->scored = 0;
+    this->deferred = 0;
+
+}
+
+/** @brief destroys InferenceScheduler.
+ *
+ *  this just destroys the InferenceScheduler
+ *
+ */
+InferenceScheduler::~InferenceScheduler(){
+
+}
+
+InferenceScheduler* InferenceScheduler::getInstance(){
+
+    if(!InferenceScheduler::instance){
+        InferenceScheduler::instance = new InferenceScheduler();
+    }
+
+    return InferenceScheduler::instance;
+}
+
+int InferenceScheduler::tier(int track, FaceTracker *tracker, float sensitivity){
+
+    if(!tracker->hasResult(track)){
+        return 0;
+    }
+    if(tracker->getResultAge(track) >= MASK_STALE_FRAMES){
+        return 1;
+    }
+    if(std::fabs(tracker->getResult(track).probability - sensitivity) < MASK_NEAR_THRESHOLD){
+        return 2;
+    }
+
+    return 3;
+}
+
+/**
+ * @brief Orders the faces of a new frame by how much they need a fresh score, larger faces first within each tier
+ *
+ * @param faces Boxes found in this frame
+ * @param tracks Track id of each box
+ * @param tracker Tracker holding the previous results
+ * @param sensitivity Current mask sensitivity
+ * @param order Set to the indices into faces in the order they should be scored
+ */
+void InferenceScheduler::rank(const vector<Rect> &faces, const vector<int> &tracks, FaceTracker *tracker, float sensitivity, vector<size_t> &order){
+
+    this->frameStart = std::chrono::steady_clock::now();
+    this->scored = 0;
+    this->deferred = 0;
+
+    vector<int> &tiers = this->tiers;
+    tiers.resize(faces.size());
+    order.resize(faces.size());
+    for(size_t i = 0; i < faces.size(); i++){
+        tiers[i] = tier(tracks[i], tracker, sensitivity);
+        order[i] = i;
+    }
+
+    std::sort(order.begin(), order.end(), [&faces, &tiers](size_t a, size_t b){
+        if(tiers[a] != tiers[b]){
+            return tiers[a] < tiers[b];
+        }
+        if(faces[a].area() != faces[b].area()){
+            return faces[a].area() > faces[b].area();
+        }
+        return a < b;
+    });
+
+}
+
+/**
+ * @return True when nothing has been scored this frame yet, or the time spent plus one more face stays within the budget
+ */
+bool InferenceScheduler::canScore(){
+
+    if(this->budgetMs <= 0 || this->scored == 0){
+        return true;
+    }
+
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - this->frameStart).count();
+
+    return elapsed + this->faceCostMs <= this->budgetMs;
+}
+
+/**
+ * @brief Folds the time one face took into the cost estimate
+ */
+void InferenceScheduler::recordScore(double milliseconds){
+
+    this->scored++;
+    this->faceCostMs = this->faceCostMs == 0.0 ? milliseconds : 0.9 * this->faceCostMs + 0.1 * milliseconds;
+
+}
+
+void InferenceScheduler::defer(){
+    this->deferred++;
+}
+
+int InferenceScheduler::getDeferredCount(){
+    return this->deferred;
+}
+
+double InferenceScheduler::getFaceCostMs(){
+    return this->faceCostMs;
+}
+
+void InferenceScheduler::setBudgetMs(double budget){
+    this->budgetMs = budget;
+}
+
+double InferenceScheduler::getBudgetMs(){
+    return this->budgetMs;
+}
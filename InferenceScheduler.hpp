@@ -0,0 +1,64 @@
+/**
+ * @file InferenceScheduler.hpp
+ * @brief Header file for the InferenceScheduler class, which decides which faces of a frame get scored within the frame's inference budget
+ */
+
+#ifndef InferenceScheduler_hpp
+#define InferenceScheduler_hpp
+
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+#include "opencv.hpp"
+#include "environment.hpp"
+#include "FaceTracker.hpp"
+
+using namespace cv;
+using namespace std;
+
+class InferenceScheduler
+{
+
+private:
+    // milliseconds of inference allowed per frame, 0 scores every face
+    double budgetMs;
+    // running estimate of what scoring one face costs
+    double faceCostMs;
+
+    std::chrono::steady_clock::time_point frameStart;
+    int scored;
+    int deferred;
+    // tier of each face this frame, kept to avoid reallocating
+    vector<int> tiers;
+
+    // lower runs first: new tracks, stale results, results near the threshold, everything else
+    int tier(int track, FaceTracker *tracker, float sensitivity);
+
+public:
+    static InferenceScheduler *instance;
+
+    // constructor
+    InferenceScheduler();
+    // destructor
+    ~InferenceScheduler();
+
+    static InferenceScheduler *getInstance();
+
+    // starts a frame and fills in the indices of its faces, most in need of a score first
+    void rank(const vector<Rect> &faces, const vector<int> &tracks, FaceTracker *tracker, float sensitivity, vector<size_t> &order);
+    // whether another face fits in what is left of this frame's budget
+    bool canScore();
+    void recordScore(double milliseconds);
+    // a face that needed a score but carries over its previous result instead
+    void defer();
+
+    // faces deferred so far in the current frame, all of them once its loop is done
+    int getDeferredCount();
+    double getFaceCostMs();
+    void setBudgetMs(double budget);
+    double getBudgetMs();
+
+};
+
+#endif /* InferenceScheduler_hpp */
@@ -0,0 +1,60 @@
+/**
+ * @file LowerFaceClassifier.cpp
+ * @brief Comprises the LowerFaceClassifier class. A face shows about as much skin around the mouth as around the eyes unless something covers it, so the ratio of the two is a rough mask score that costs a few microseconds on a 48x48 crop
+ * @bug Scarves, beards and strong side lighting also hide skin, which is why uncertain scores still go to the model
+ */
+
+/** -- Includes -- **/
+#include "LowerFaceClassifier.hpp"
+
+#include <algorithm>
+
+// the crop is shrunk to this before anything else, the check does not need detail
+static const int STAGE_SIZE = 48;
+
+/**
+ * @brief Counts the pixels inside the usual skin range of the Cr and Cb channels
+ *
+ * @param ycrcb Face converted to YCrCb
+ * @param region Part of the face to look at
+ * @return Fraction of the region that looks like skin
+ */
+float LowerFaceClassifier::skinFraction(const Mat &ycrcb, Rect region){
+
+    Mat skin;
+    inRange(ycrcb(region), Scalar(0, 133, 77), Scalar(255, 173, 127), skin);
+
+    return (float)countNonZero(skin) / region.area();
+}
+
+/**
+ * @brief Compares the skin visible around the mouth and chin with the skin around the eyes and cheeks
+ *
+ * @param face Face of BGR pixels, any size
+ * @param maskScore Set to 1 when the lower half shows no skin, 0 when it shows as much as the upper half
+ * @return False when the face shows too little skin to compare, maskScore is left alone and the face needs the model
+ */
+bool LowerFaceClassifier::score(const Mat &face, float &maskScore){
+
+    Mat small;
+    resize(face, small, Size(STAGE_SIZE, STAGE_SIZE), 0, 0, INTER_AREA);
+
+    Mat ycrcb;
+    cvtColor(small, ycrcb, COLOR_BGR2YCrCb);
+
+    // the middle of the face, leaving out hair, ears and background at the sides
+    Rect eyes(STAGE_SIZE / 4, STAGE_SIZE / 6, STAGE_SIZE / 2, STAGE_SIZE / 3);
+    Rect mouth(STAGE_SIZE / 4, STAGE_SIZE * 5 / 8, STAGE_SIZE / 2, STAGE_SIZE / 4);
+
+    float upper = skinFraction(ycrcb, eyes);
+    float lower = skinFraction(ycrcb, mouth);
+
+    // no skin tone to compare against, e.g. sunglasses or a poorly lit face
+    if(upper < 0.15f){
+        return false;
+    }
+
+    maskScore = std::min(1.f, std::max(0.f, 1.f - lower / upper));
+
+    return true;
+}
@@ -0,0 +1,28 @@
+/**
+ * @file LowerFaceClassifier.hpp
+ * @brief Header file for the LowerFaceClassifier class, a cheap colour check of the lower half of a face used as the first stage in front of the mask model
+ */
+
+#ifndef LowerFaceClassifier_hpp
+#define LowerFaceClassifier_hpp
+
+#include <stdio.h>
+
+#include "opencv.hpp"
+
+using namespace cv;
+
+class LowerFaceClassifier
+{
+
+private:
+    // fraction of skin coloured pixels in a region of a YCrCb face
+    static float skinFraction(const Mat &ycrcb, Rect region);
+
+public:
+    // mask score from 0 to 1, false when there is too little skin on the face to tell
+    static bool score(const Mat &face, float &maskScore);
+
+};
+
+#endif /* LowerFaceClassifier_hpp */
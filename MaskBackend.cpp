@@ -0,0 +1,204 @@
+/**
+ * @file MaskBackend.cpp
+ * @brief Comprises the MaskBackend class, which picks and loads the runtime a mask model runs on and holds the preprocessing every runtime shares
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "MaskBackend.hpp"
+#include "OnnxRuntimeBackend.hpp"
+#include "OpenCVBackend.hpp"
+#include "TFLiteBackend.hpp"
+
+#ifndef BIGBROTHER_WITHOUT_TENSORFLOW
+#include "TensorFlowBackend.hpp"
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <stdlib.h>
+
+/**
+ * @brief Reads an integer environment variable
+ *
+ * @param name Name of the variable
+ * @param fallback Value when the variable is unset or empty
+ */
+static int environmentInt(const char *name, int fallback){
+
+    const char *value = getenv(name);
+
+    return value && *value ? atoi(value) : fallback;
+}
+
+/**
+ * @brief Session layout from environment.hpp, with the BIGBROTHER_* variables taking precedence so a kiosk can be tuned without a rebuild
+ */
+SessionConfig SessionConfig::fromEnvironment(){
+
+    SessionConfig config;
+    config.sessions = std::max(1, environmentInt("BIGBROTHER_MASK_SESSIONS", MASK_SESSIONS));
+    config.intraOpThreads = environmentInt("BIGBROTHER_INTRA_OP_THREADS", MASK_INTRA_OP_THREADS);
+    config.interOpThreads = environmentInt("BIGBROTHER_INTER_OP_THREADS", MASK_INTER_OP_THREADS);
+
+    return config;
+}
+
+/**
+ * @brief Constructor for MaskBackend, the runtime specific loading happens in the subclasses
+ *
+ * @param location Path of the model
+ * @param config Number of sessions and threads per session
+ */
+MaskBackend::MaskBackend(string location, SessionConfig config){
+
+    this->location = location;
+    this->config = config;
+
+}
+
+/** @brief destroys MaskBackend.
+ *
+ *  this just destroys the MaskBackend
+ *
+ */
+MaskBackend::~MaskBackend(){
+
+}
+
+/**
+ * @brief Writes a face into a Mat header over its rows of a batch buffer, so OpenCV converts straight into the runtime's memory
+ *
+ * @param face Face of BGR pixels, resized if it is not IMG_SIZE x IMG_SIZE
+ * @param slot Header over the face's part of the buffer, its type is the type the model takes
+ * @param scale Multiplier applied to each pixel, e.g. 1/255 for float models
+ * @param offset Added after scaling, e.g. the zero point of a quantized model
+ */
+void MaskBackend::packFace(const Mat &face, Mat &slot, double scale, double offset){
+
+    Mat resized = face;
+    if(face.rows != IMG_SIZE || face.cols != IMG_SIZE){
+        resize(face, resized, Size(IMG_SIZE, IMG_SIZE));
+    }
+
+    // one vectorized pass, the slot already has the right size and type so nothing is reallocated
+    resized.convertTo(slot, slot.type(), scale, offset);
+
+}
+
+/**
+ * @brief Picks a backend from the model's extension
+ *
+ * @param location Path of the model
+ * @return Name of the backend that reads that format
+ */
+string MaskBackend::backendFor(string location){
+
+    auto endsWith = [&location](const string &extension){
+        return location.size() > extension.size() && location.compare(location.size() - extension.size(), extension.size(), extension) == 0;
+    };
+
+    if(endsWith(".tflite")){
+        return "tflite";
+    }
+    if(endsWith(".onnx")){
+#ifdef BIGBROTHER_WITH_ONNXRUNTIME
+        return "onnxruntime";
+#else
+        return "opencv";
+#endif
+    }
+
+#ifdef BIGBROTHER_WITHOUT_TENSORFLOW
+    // OpenCV reads frozen graphs too, SavedModel folders need TensorFlow and fail to load
+    return "opencv";
+#else
+    return "tensorflow";
+#endif
+}
+
+/**
+ * @return MASK_BACKEND, or BIGBROTHER_MASK_BACKEND when it is set
+ */
+string MaskBackend::backendFromEnvironment(){
+
+    const char *backend = getenv("BIGBROTHER_MASK_BACKEND");
+
+    return backend && *backend ? backend : MASK_BACKEND;
+}
+
+/**
+ * @return Names of the backends compiled into this build
+ */
+vector<string> MaskBackend::getAvailableBackends(){
+
+    vector<string> backends;
+
+#ifndef BIGBROTHER_WITHOUT_TENSORFLOW
+    backends.push_back("tensorflow");
+#endif
+    backends.push_back("opencv");
+#ifdef BIGBROTHER_WITH_TFLITE
+    backends.push_back("tflite");
+#endif
+#ifdef BIGBROTHER_WITH_ONNXRUNTIME
+    backends.push_back("onnxruntime");
+#endif
+
+    return backends;
+}
+
+/**
+ * @brief Loads and warms up a model on the named backend
+ *
+ * @param location Path of the model
+ * @param backend Name of the backend, or "auto" to pick one from the extension
+ * @param config Number of sessions and threads per session
+ * @return The loaded backend
+ */
+std::shared_ptr<MaskBackend> MaskBackend::load(string location, string backend, SessionConfig config){
+
+    if(backend.empty() || backend == "auto"){
+        backend = backendFor(location);
+    }
+
+#ifndef BIGBROTHER_WITHOUT_TENSORFLOW
+    if(backend == "tensorflow"){
+        return std::make_shared<TensorFlowBackend>(location, config);
+    }
+#endif
+    if(backend == "opencv"){
+        return std::make_shared<OpenCVBackend>(location, config);
+    }
+
+#ifdef BIGBROTHER_WITH_TFLITE
+    if(backend == "tflite"){
+        return std::make_shared<TFLiteBackend>(location, config);
+    }
+#endif
+#ifdef BIGBROTHER_WITH_ONNXRUNTIME
+    if(backend == "onnxruntime"){
+        return std::make_shared<OnnxRuntimeBackend>(location, config);
+    }
+#endif
+
+    throw std::runtime_error("The " + backend + " backend is not part of this build");
+}
+
+string MaskBackend::getLocation(){
+
+    return this->location;
+}
+
+SessionConfig MaskBackend::getConfig(){
+
+    return this->config;
+}
+
+/**
+ * @brief Backends that do not pool their inputs report none
+ */
+long MaskBackend::getInputSlots(){
+
+    return 0;
+}
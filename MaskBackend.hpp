@@ -0,0 +1,65 @@
+/**
+ * @file MaskBackend.hpp
+ * @brief Header file for the MaskBackend class, the interface each inference runtime implements so the mask model can run on whichever one suits the device
+ */
+
+#ifndef MaskBackend_hpp
+#define MaskBackend_hpp
+
+#include <stdio.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opencv.hpp"
+#include "environment.hpp"
+
+using namespace cv;
+using namespace std;
+
+// how many sessions (or interpreters) a model is spread over and how many threads each one gets
+struct SessionConfig {
+    int sessions;
+    int intraOpThreads;
+    int interOpThreads;
+
+    // environment.hpp defaults, overridden by the BIGBROTHER_* environment variables
+    static SessionConfig fromEnvironment();
+};
+
+class MaskBackend
+{
+
+protected:
+    string location;
+    SessionConfig config;
+
+    // writes one face into its slot of a batch buffer, resizing if needed and converting to the slot's type
+    static void packFace(const Mat &face, Mat &slot, double scale, double offset);
+
+public:
+    // constructor
+    MaskBackend(string location, SessionConfig config);
+    // destructor
+    virtual ~MaskBackend();
+
+    // load and warm up a model on the named backend, "auto" picks one from the file extension
+    static std::shared_ptr<MaskBackend> load(string location, string backend, SessionConfig config);
+    static string backendFor(string location);
+    // MASK_BACKEND, overridden by BIGBROTHER_MASK_BACKEND
+    static string backendFromEnvironment();
+    // backends compiled into this build
+    static vector<string> getAvailableBackends();
+
+    string getLocation();
+    SessionConfig getConfig();
+
+    virtual string getName() = 0;
+    // mask probability of up to MAX_BATCH_SIZE faces, safe to call from many threads
+    virtual void run(const Mat *faces, int count, float *probabilities) = 0;
+    // pooled input slots created so far, for backends that pool their inputs
+    virtual long getInputSlots();
+
+};
+
+#endif /* MaskBackend_hpp */
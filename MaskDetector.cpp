@@ -6,18 +6,46 @@
 
 /** -- Includes -- **/
 #include "MaskDetector.hpp"
+#include "LowerFaceClassifier.hpp"
 
-cppflow::model model(MASK_MODEL_LOCATION);
+#ifndef BIGBROTHER_WITHOUT_TENSORFLOW
+#include "TensorFlowBackend.hpp"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdlib.h>
 
 MaskDetector* MaskDetector::instance = nullptr;
 
+// source of the faces the first stage decided, their probability only encodes that decision
+static const string FIRST_STAGE_SOURCE = "first stage";
+
+/**
+ * @brief Reads an integer environment variable, falling back when it is unset or empty
+ */
+static int environmentInt(const char *name, int fallback){
+    
+    const char *value = getenv(name);
+    
+    return value && *value ? atoi(value) : fallback;
+}
+
 /**
  * @brief Constructor for MaskDetector class, required as every instance needs to have a command to execute
  */ 
-MaskDetector::MaskDetector(){
+MaskDetector::MaskDetector() : cache(environmentInt("BIGBROTHER_MASK_CACHE_SIZE", MASK_CACHE_SIZE), environmentInt("BIGBROTHER_MASK_CACHE_TOLERANCE", MASK_CACHE_TOLERANCE), MASK_CACHE_VERIFY_EVERY){
     
     this->maskSensitivity = 0.2;
     
+    const char *band = getenv("BIGBROTHER_MASK_CASCADE_BAND");
+    this->cascadeEnabled = environmentInt("BIGBROTHER_MASK_CASCADE", MASK_CASCADE) != 0;
+    this->uncertaintyBand = band && *band ? atof(band) : MASK_CASCADE_BAND;
+    this->cascadeFaces = 0;
+    this->escalatedFaces = 0;
+    this->cacheGeneration = 0;
+    
 }
 
 /** @brief destroys MaskDetector.
@@ -29,57 +57,395 @@ MaskDetector::~MaskDetector(){
     
 }
 
-MaskDetector* MaskDetector::getInstance() {
+/**
+ * @brief Returns the singleton class object for MaskDetector
+ *
+ * @param loadDefault Start loading the default model when the detector is created, off when the caller starts the load itself
+ * @return MaskDetector Singleton
+ */
+MaskDetector* MaskDetector::getInstance(bool loadDefault) {
     
     if(!MaskDetector::instance){
         MaskDetector::instance = new MaskDetector();
+        // start loading as soon as someone needs the detector, without blocking them
+        if(loadDefault){
+            MaskDetector::instance->loadDefaultModel();
+        }
     }
     
     return MaskDetector::instance;
 }
 
 /**
- * @brief Calculates the probability of mask compliance
+ * @brief Loads BIGBROTHER_MASK_MODEL, or MASK_MODEL_LOCATION when it is unset, on a background thread
+ */
+void MaskDetector::loadDefaultModel(){
+    
+    const char *location = getenv("BIGBROTHER_MASK_MODEL");
+    loadModel(location ? location : MASK_MODEL_LOCATION);
+    
+}
+
+/**
+ * @brief Loads a model version on a background thread. The first load makes the detector ready, later loads replace the running model once warmed up
+ *
+ * @param location Path of the SavedModel folder, frozen graph or .tflite file
+ * @param backend Runtime to run it on, "auto" picks one from the extension
+ * @param config Number of sessions the model is spread over and the threads each one uses
+ */
+void MaskDetector::loadModel(string location, string backend, SessionConfig config){
+    
+    this->registry.load(location, backend, config);
+    
+}
+
+/**
+ * @brief Goes back to the model version that was running before the last swap
+ *
+ * @return False if there is no earlier version
+ */
+bool MaskDetector::rollbackModel(){
+    
+    return this->registry.rollback();
+}
+
+/**
+ * @brief Checks without blocking whether a model is loaded and warmed up
+ *
+ * @return True once maskProbability can be called without waiting
+ */
+bool MaskDetector::isModelReady(){
+    
+    return this->registry.acquire() != nullptr;
+}
+
+/**
+ * @return True while a model version is loading in the background
+ */
+bool MaskDetector::isModelLoading(){
+    
+    return this->registry.isLoading();
+}
+
+/**
+ * @brief Blocks until the latest load finishes, rethrowing the load error if there was one
+ */
+void MaskDetector::waitForModel(){
+    
+    this->registry.waitForLoad();
+    
+}
+
+/**
+ * @brief Reports why the latest model load failed
+ *
+ * @return The load error, or an empty string while loading or after a successful load
+ */
+string MaskDetector::getModelError(){
+    
+    return this->registry.getLastError();
+}
+
+/**
+ * @return Location of the model version new calls run on
+ */
+string MaskDetector::getModelLocation(){
+    
+    return this->registry.getCurrentLocation();
+}
+
+/**
+ * @return Name of the runtime new calls run on
+ */
+string MaskDetector::getModelBackend(){
+    
+    return this->registry.getCurrentBackend();
+}
+
+/**
+ * @brief Gets the model version to run a call on, blocking until the first load finishes if nothing is loaded yet
+ *
+ * @param generation Set to the version's generation when not null
+ * @return The version, holding on to it keeps it alive even if it is swapped out mid call
+ */
+std::shared_ptr<MaskBackend> MaskDetector::acquireVersion(uint64_t *generation){
+    
+    auto version = this->registry.acquire(generation);
+    if(!version){
+        waitForModel();
+        version = this->registry.acquire(generation);
+    }
+    
+    return version;
+}
+
+/**
+ * @brief Runs one batch on a model version
+ *
+ * @param version Version acquired at the start of the call, every batch of the call runs on it
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @param count Number of faces, at most MAX_BATCH_SIZE
+ * @param probabilities Filled with the mask probability of each face
+ * @param sources Filled with the backend's name when not null
+ */
+void MaskDetector::runBatch(const std::shared_ptr<MaskBackend> &version, const Mat *faces, int count, float *probabilities, string *sources){
+    
+    version->run(faces, count, probabilities);
+    
+    if(sources){
+        std::fill(sources, sources + count, version->getName());
+    }
+    
+}
+
+/**
+ * @brief Scores every face with the first stage when the cascade is on and sends only the uncertain ones to the model
+ *
+ * The first stage score is not a calibrated probability, so faces it is sure about get the edge of the band on the side it decided instead. That keeps the decision if the sensitivity moves by less than the band later, without passing the score off as a model probability. Faces it cannot judge at all always go to the model
+ *
+ * @param version Version acquired at the start of the call
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @param count Number of faces
+ * @param probabilities Filled with the mask probability of each face
+ * @param sources Filled with what produced each probability when not null
+ */
+void MaskDetector::runCascade(const std::shared_ptr<MaskBackend> &version, const Mat *faces, size_t count, float *probabilities, string *sources){
+    
+    int maxBatch = MAX_BATCH_SIZE;
+    
+    if(!this->cascadeEnabled){
+        for(size_t start = 0; start < count; start += maxBatch){
+            int batch = (int)std::min(count - start, (size_t)maxBatch);
+            runBatch(version, faces + start, batch, probabilities + start, sources ? sources + start : nullptr);
+        }
+        return;
+    }
+    
+    vector<Mat> uncertain;
+    vector<size_t> positions;
+    
+    // read once so every face of the call is judged against the same values
+    float sensitivity = this->maskSensitivity;
+    float band = this->uncertaintyBand;
+    
+    for(size_t i = 0; i < count; i++){
+        float score;
+        bool known = LowerFaceClassifier::score(faces[i], score);
+        if(!known || std::fabs(score - sensitivity) <= band){
+            uncertain.push_back(faces[i]);
+            positions.push_back(i);
+        }else{
+            probabilities[i] = score > sensitivity ? std::min(1.f, sensitivity + band) : std::max(0.f, sensitivity - band);
+            if(sources){
+                sources[i] = FIRST_STAGE_SOURCE;
+            }
+        }
+    }
+    
+    this->cascadeFaces += count;
+    this->escalatedFaces += uncertain.size();
+    
+    float results[MAX_BATCH_SIZE];
+    string resultSources[MAX_BATCH_SIZE];
+    for(size_t start = 0; start < uncertain.size(); start += maxBatch){
+        int batch = (int)std::min(uncertain.size() - start, (size_t)maxBatch);
+        runBatch(version, uncertain.data() + start, batch, results, resultSources);
+        for(int i = 0; i < batch; i++){
+            probabilities[positions[start + i]] = results[i];
+            if(sources){
+                sources[positions[start + i]] = resultSources[i];
+            }
+        }
+    }
+    
+}
+
+/**
+ * @brief Looks every face up in the probability cache and runs only the misses, plus the odd hit that is sampled for verification
+ *
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @param count Number of faces
+ * @param probabilities Filled with the mask probability of each face
+ * @param sources Filled with what produced each probability when not null
+ */
+void MaskDetector::runCached(const Mat *faces, size_t count, float *probabilities, string *sources){
+    
+    // the whole call runs on one version, even if another is swapped in meanwhile
+    uint64_t generation;
+    auto version = acquireVersion(&generation);
+    
+    if(!this->cache.isEnabled()){
+        runCascade(version, faces, count, probabilities, sources);
+        return;
+    }
+    
+    // cached probabilities belong to the model that produced them, a call still on an older version must not wind the cache back
+    {
+        std::lock_guard<std::mutex> guard(this->cacheGenerationLock);
+        if(generation > this->cacheGeneration){
+            this->cache.clear();
+            this->cacheGeneration = generation;
+        }
+    }
+    
+    vector<uint64_t> hashes(count);
+    vector<Mat> misses;
+    vector<size_t> positions;
+    vector<bool> verifying;
+    
+    for(size_t i = 0; i < count; i++){
+        hashes[i] = ProbabilityCache::hash(faces[i]);
+        
+        bool verify;
+        if(this->cache.lookup(hashes[i], probabilities[i], verify) && !verify){
+            if(sources){
+                sources[i] = "cache";
+            }
+            continue;
+        }
+        
+        misses.push_back(faces[i]);
+        positions.push_back(i);
+        verifying.push_back(verify);
+    }
+    
+    vector<float> fresh(misses.size());
+    vector<string> freshSources(misses.size());
+    runCascade(version, misses.data(), misses.size(), fresh.data(), freshSources.data());
+    
+    // a newer version may have cleared the cache while this call ran, its results must not go back in
+    std::lock_guard<std::mutex> guard(this->cacheGenerationLock);
+    bool current = generation == this->cacheGeneration;
+    
+    for(size_t j = 0; j < misses.size(); j++){
+        size_t i = positions[j];
+        // only model probabilities are cached, a first stage decision is cheap to make again
+        bool fromModel = freshSources[j] != FIRST_STAGE_SOURCE;
+        if(verifying[j] && fromModel){
+            this->cache.recordVerification(probabilities[i], fresh[j]);
+        }
+        probabilities[i] = fresh[j];
+        if(sources){
+            sources[i] = freshSources[j];
+        }
+        if(current && fromModel){
+            this->cache.insert(hashes[i], fresh[j]);
+        }
+    }
+    
+}
+
+/**
+ * @brief Classifies a face with a single inference, waiting for the model if it is still loading
+ *
+ * @param face Face of BGR pixels, resized to IMG_SIZE x IMG_SIZE if needed
+ * @return Probability, the decision at the current sensitivity, what produced it and how long it took
+ */
+MaskResult MaskDetector::classify(const Mat &face){
+    
+    Mat finalSize = face;
+    if(face.rows != IMG_SIZE || face.cols != IMG_SIZE){
+        resize(face, finalSize, Size(IMG_SIZE, IMG_SIZE));
+    }
+    
+    MaskResult result;
+    
+    auto start = std::chrono::steady_clock::now();
+    runCached(&finalSize, 1, &result.probability, &result.backend);
+    result.latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    result.hasMask = result.probability > this->maskSensitivity;
+    
+    return result;
+}
+
+/**
+ * @brief Classifies many faces, batching them into as few model calls as possible
+ *
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @return Result of each face in the same order, the latency is that of the whole call
+ */
+vector<MaskResult> MaskDetector::classify(const vector<Mat> &faces){
+    
+    vector<float> probabilities(faces.size());
+    vector<string> sources(faces.size());
+    
+    auto start = std::chrono::steady_clock::now();
+    runCached(faces.data(), faces.size(), probabilities.data(), sources.data());
+    double latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    vector<MaskResult> results(faces.size());
+    for(size_t i = 0; i < faces.size(); i++){
+        results[i].probability = probabilities[i];
+        results[i].hasMask = probabilities[i] > this->maskSensitivity;
+        results[i].backend = sources[i];
+        results[i].latencyMs = latencyMs;
+    }
+    
+    return results;
+}
+
+/**
+ * @brief Calculates the probability of mask compliance, waiting for the model if it is still loading
  * 
  * @param faceIn Input of face object/array, to be extracted
  * @return Value of mask probability as a float
  */ 
 float MaskDetector::maskProbability(Mat faceIn){
     
-    Mat face = faceIn.clone();
+    float probWithMask = 0.f;
     
-    // extract the matrix data which comes as a unsigned char
-    std::vector<uchar> array;
-    if (face.isContinuous()) {
-      array.assign(face.data, face.data + face.total()*face.channels());
-    } else {
-      for (int i = 0; i < face.rows; ++i) {
-        array.insert(array.end(), face.ptr<uchar>(i), face.ptr<uchar>(i)+face.cols*face.channels());
-      }
-    }
+    runCached(&faceIn, 1, &probWithMask);
     
-    // Put image in Tensor
-    std::vector<uchar> temp; // This is a flat vector
+    return probWithMask;
     
-    // setup the tensor with a flat version of the matrix
-    temp.assign(face.data, face.data + face.total() * face.channels()); // Fill the flat std::vector with data
+}
 
+/**
+ * @brief Calculates the probability of mask compliance for many faces, batching them into as few model calls as possible
+ *
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @return Mask probability of each face, in the same order
+ */
+vector<float> MaskDetector::maskProbabilities(const vector<Mat> &faces){
     
-    // convert everything to final img_data matrix that is normalized to floats for channels
-    std::vector<float> img_data; // This is a flat vector
-    for(uchar i : temp)
-        img_data.push_back((float)i/255.f);
+    vector<float> probabilities(faces.size());
     
-    // create a 4D tensor and feed in the shape of the image 150x150 pixels with 3 channels of RBG
-    auto input = cppflow::tensor(img_data, {1, 150, 150, 3});
+    runCached(faces.data(), faces.size(), probabilities.data());
     
-    auto output = model({{"serving_default_conv2d_input", input}},{"StatefulPartitionedCall:0"});
+    return probabilities;
+}
+
+/**
+ * @brief Number of pooled input slots created so far, it should stop growing once each batch size has been used
+ */
+long MaskDetector::getInputSlots(){
     
-    float probWithMask = output[0].get_data<float>()[1];
+    auto version = this->registry.acquire();
     
-    return probWithMask;
+    return version ? version->getInputSlots() : 0;
+}
+
+#ifndef BIGBROTHER_WITHOUT_TENSORFLOW
+/**
+ * @brief Traces every n-th run of the running model version and collects per-op timings and memory
+ *
+ * Versions swapped in later start out unprofiled, call this again after a swap
+ *
+ * @param everyNRuns How often to trace, 0 turns profiling off
+ * @return The profiler collecting the results, or nullptr when turned off, no model is loaded yet or the backend is not TensorFlow
+ */
+std::shared_ptr<cppflow::profiler> MaskDetector::setProfiling(int everyNRuns){
     
+    // only the TensorFlow runtime exposes per-op step stats
+    auto version = std::dynamic_pointer_cast<TensorFlowBackend>(this->registry.acquire());
+    if(!version){
+        return nullptr;
+    }
+    
+    return version->setProfiling(everyNRuns);
 }
+#endif
 
 /**
  * @brief Calculates the probabilty that a mask is worn based on the sensitivity which is set by the user
@@ -109,3 +475,55 @@ void MaskDetector::setMaskSensitivity(float sensitivity){
 float MaskDetector::getMaskSensitivity(){
     return this->maskSensitivity;
 }
+
+/**
+ * @brief Turns the first stage on or off and sets how close to the sensitivity a score must be to go to the model
+ *
+ * A wider band sends more faces to the model, trading throughput for accuracy
+ *
+ * @param enabled Whether faces go through the first stage
+ * @param band Distance from the sensitivity that still counts as uncertain, 1 sends every face to the model
+ */
+void MaskDetector::setCascade(bool enabled, float band){
+    this->cascadeEnabled = enabled;
+    this->uncertaintyBand = band;
+}
+
+bool MaskDetector::isCascadeEnabled(){
+    return this->cascadeEnabled;
+}
+
+float MaskDetector::getUncertaintyBand(){
+    return this->uncertaintyBand;
+}
+
+/**
+ * @return Fraction of faces sent on to the model since the last reset, 0 before any face went through the first stage
+ */
+float MaskDetector::getEscalationRate(){
+    
+    long faces = this->cascadeFaces;
+    
+    return faces ? (float)this->escalatedFaces / faces : 0.f;
+}
+
+long MaskDetector::getCascadeFaces(){
+    return this->cascadeFaces;
+}
+
+long MaskDetector::getEscalatedFaces(){
+    return this->escalatedFaces;
+}
+
+void MaskDetector::resetCascadeStats(){
+    this->cascadeFaces = 0;
+    this->escalatedFaces = 0;
+}
+
+ProbabilityCache *MaskDetector::getProbabilityCache(){
+    return &this->cache;
+}
+
+ProbabilityStore *MaskDetector::getProbabilityStore(){
+    return &this->probabilities;
+}
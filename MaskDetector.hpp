@@ -7,19 +7,68 @@
 #define MaskDetector_hpp
 
 #include <stdio.h>
-#include "cppflow/cppflow.h"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
 #include "opencv.hpp"
 #include "environment.hpp"
+#include "ModelRegistry.hpp"
+#include "ProbabilityCache.hpp"
+#include "ProbabilityStore.hpp"
+
+#ifndef BIGBROTHER_WITHOUT_TENSORFLOW
+#include "cppflow/cppflow.h"
+#endif
 
 using namespace std;
 //using namespace cppflow;
 using namespace cv;
 
+// everything one classification produced, from a single run of the model
+struct MaskResult {
+    // from the model, or the edge of the uncertainty band on the side the first stage decided
+    float probability = 0.f;
+    // probability compared with the sensitivity at the time of the call
+    bool hasMask = false;
+    // backend that ran the model, or "cache" / "first stage" when the model was not needed
+    string backend;
+    double latencyMs = 0.0;
+};
+
 class MaskDetector
 {
 private:
 
-    float maskSensitivity;
+    // written by the UI thread while the pipeline reads them
+    std::atomic<float> maskSensitivity;
+    
+    // active model version plus the one before it for rollback
+    ModelRegistry registry;
+    
+    // cheap first stage, only faces it is unsure about go to the model
+    std::atomic<bool> cascadeEnabled;
+    std::atomic<float> uncertaintyBand;
+    std::atomic<long> cascadeFaces;
+    std::atomic<long> escalatedFaces;
+    
+    // probabilities of faces seen recently, and the generation of the model version they came from
+    ProbabilityCache cache;
+    uint64_t cacheGeneration;
+    std::mutex cacheGenerationLock;
+    
+    // mask probability of every face counted towards compliance, compliance and the histogram are both read from it
+    ProbabilityStore probabilities;
+    
+    // the current model version, waiting for the first load if needed
+    std::shared_ptr<MaskBackend> acquireVersion(uint64_t *generation = nullptr);
+    // run one model version over up to MAX_BATCH_SIZE faces
+    void runBatch(const std::shared_ptr<MaskBackend> &version, const Mat *faces, int count, float *probabilities, string *sources = nullptr);
+    // run the first stage, then the model version over the uncertain faces in batches
+    void runCascade(const std::shared_ptr<MaskBackend> &version, const Mat *faces, size_t count, float *probabilities, string *sources = nullptr);
+    // answer faces from the cache where possible, the rest go through the cascade
+    void runCached(const Mat *faces, size_t count, float *probabilities, string *sources = nullptr);
 
 
 public:
@@ -30,13 +79,49 @@ public:
     // destructor
     ~MaskDetector();
     
-    static MaskDetector *getInstance();
+    static MaskDetector *getInstance(bool loadDefault = true);
+    
+    // model loading happens on a background thread, later loads hot swap the running model
+    void loadModel(string location, string backend = MaskBackend::backendFromEnvironment(), SessionConfig config = SessionConfig::fromEnvironment());
+    void loadDefaultModel();
+    bool rollbackModel();
+    bool isModelReady();
+    bool isModelLoading();
+    void waitForModel();
+    string getModelError();
+    string getModelLocation();
+    string getModelBackend();
 
+    MaskResult classify(const Mat &face);
+    vector<MaskResult> classify(const vector<Mat> &faces);
+    
     bool hasMask(Mat);
     float maskProbability(Mat);
+    vector<float> maskProbabilities(const vector<Mat> &faces);
+    long getInputSlots();
+    
+#ifndef BIGBROTHER_WITHOUT_TENSORFLOW
+    // per-op profiling of the running model version, 0 turns it off
+    std::shared_ptr<cppflow::profiler> setProfiling(int everyNRuns);
+#endif
     
     void setMaskSensitivity(float sensitivity);
     float getMaskSensitivity();
+    
+    // first stage in front of the model, band is the distance from the sensitivity that still counts as uncertain
+    void setCascade(bool enabled, float band);
+    bool isCascadeEnabled();
+    float getUncertaintyBand();
+    // fraction of faces the first stage sent on to the model since the last reset
+    float getEscalationRate();
+    long getCascadeFaces();
+    long getEscalatedFaces();
+    void resetCascadeStats();
+    
+    // hit rate, size, tolerance and sampled error of the probability cache
+    ProbabilityCache *getProbabilityCache();
+    // every counted face's probability, the caller decides which faces count
+    ProbabilityStore *getProbabilityStore();
 
 };
 
@@ -0,0 +1,193 @@
+/**
+ * @file ModelRegistry.cpp
+ * @brief Comprises the ModelRegistry class. New versions load and warm up on a background thread, then replace the current one with a single atomic pointer swap so calls already running finish on the version they started with
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "ModelRegistry.hpp"
+
+/**
+ * @brief Constructor for ModelRegistry, it starts out empty until load is called
+ */
+ModelRegistry::ModelRegistry(){
+
+}
+
+/** @brief destroys ModelRegistry.
+ *
+ *  this just destroys the ModelRegistry
+ *
+ */
+ModelRegistry::~ModelRegistry(){
+
+}
+
+/**
+ * @brief Loads a version on a background thread and makes it current once it is warmed up, the old current version is kept for rollback
+ *
+ * Only one load runs at a time. Asking again while one is running queues the new location to load as soon as the running one finishes, replacing any request queued before it
+ *
+ * @param location Path of the model
+ * @param backend Runtime to load it on, "auto" picks one from the extension
+ * @param config Number of sessions and threads per session
+ * @return Future that resolves once the queue has drained, holding the error of the last load if it failed
+ */
+std::shared_future<void> ModelRegistry::load(string location, string backend, SessionConfig config){
+
+    std::lock_guard<std::mutex> lock(swapLock);
+
+    this->queued = LoadRequest{location, backend, config};
+    this->hasQueued = true;
+
+    if(this->loading){
+        return this->pending;
+    }
+
+    this->loading = true;
+    this->pending = std::async(std::launch::async, [this](){ loadQueued(); }).share();
+
+    return this->pending;
+}
+
+/**
+ * @brief Runs on the background thread, loading the queued request and then any request queued while it loaded
+ */
+void ModelRegistry::loadQueued(){
+
+    while(true){
+
+        LoadRequest request;
+        {
+            std::lock_guard<std::mutex> lock(swapLock);
+
+            if(!this->hasQueued){
+                this->loading = false;
+                return;
+            }
+
+            request = this->queued;
+            this->hasQueued = false;
+        }
+
+        std::shared_ptr<MaskBackend> version;
+
+        try {
+            version = MaskBackend::load(request.location, request.backend, request.config);
+        } catch (const std::exception &e) {
+            std::lock_guard<std::mutex> lock(swapLock);
+            this->lastError = e.what();
+
+            // a newer request replaces the failed one, otherwise the error is handed to the future
+            if(this->hasQueued){
+                continue;
+            }
+
+            this->loading = false;
+            throw;
+        }
+
+        std::lock_guard<std::mutex> lock(swapLock);
+        this->previous = std::atomic_load(&this->current);
+        std::atomic_store(&this->current, version);
+        this->generation++;
+        this->lastError = "";
+    }
+}
+
+/**
+ * @brief Blocks until the latest load has finished, rethrowing the load error if there was one
+ */
+void ModelRegistry::waitForLoad(){
+
+    std::shared_future<void> latest;
+    {
+        std::lock_guard<std::mutex> lock(swapLock);
+        latest = this->pending;
+    }
+
+    if(latest.valid()){
+        latest.get();
+    }
+}
+
+/**
+ * @return True while a version is loading in the background
+ */
+bool ModelRegistry::isLoading(){
+
+    std::lock_guard<std::mutex> lock(swapLock);
+
+    return this->loading;
+}
+
+/**
+ * @brief Gets the version to run a call on, holding on to the returned pointer keeps that version alive even if it is swapped out mid call
+ *
+ * @param generation Set to the generation of the returned version when not null, it changes with every swap and rollback
+ * @return The current version, or an empty pointer if nothing has loaded yet
+ */
+std::shared_ptr<MaskBackend> ModelRegistry::acquire(uint64_t *generation){
+
+    if(!generation){
+        return std::atomic_load(&this->current);
+    }
+
+    // the version and its generation have to be read together
+    std::lock_guard<std::mutex> lock(swapLock);
+    *generation = this->generation;
+
+    return std::atomic_load(&this->current);
+}
+
+/**
+ * @brief Swaps the current and previous versions
+ *
+ * @return False if there is no previous version to go back to
+ */
+bool ModelRegistry::rollback(){
+
+    std::lock_guard<std::mutex> lock(swapLock);
+
+    if(!this->previous){
+        return false;
+    }
+
+    std::shared_ptr<MaskBackend> rolledBack = this->previous;
+    this->previous = std::atomic_load(&this->current);
+    std::atomic_store(&this->current, rolledBack);
+    this->generation++;
+
+    return true;
+}
+
+string ModelRegistry::getCurrentLocation(){
+
+    auto version = acquire();
+
+    return version ? version->getLocation() : "";
+}
+
+string ModelRegistry::getCurrentBackend(){
+
+    auto version = acquire();
+
+    return version ? version->getName() : "";
+}
+
+string ModelRegistry::getPreviousLocation(){
+
+    std::lock_guard<std::mutex> lock(swapLock);
+
+    return this->previous ? this->previous->getLocation() : "";
+}
+
+/**
+ * @return Why the latest load failed, or an empty string if it succeeded or is still running
+ */
+string ModelRegistry::getLastError(){
+
+    std::lock_guard<std::mutex> lock(swapLock);
+
+    return this->lastError;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file ModelRegistry.hpp
+ * @brief Header file for the ModelRegistry class, which holds the active mask model and lets a new version be swapped in (or rolled back) while the pipeline keeps running
+ */
+
+#ifndef ModelRegistry_hpp
+#define ModelRegistry_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "MaskBackend.hpp"
+#include "environment.hpp"
+
+using namespace std;
+
+class ModelRegistry
+{
+
+private:
+    // read with std::atomic_load so a swap never tears an in-flight call
+    std::shared_ptr<MaskBackend> current;
+    // kept loaded so a bad deploy can be rolled back instantly
+    std::shared_ptr<MaskBackend> previous;
+
+    // the latest version asked for while another one was loading, only the newest request is kept
+    struct LoadRequest {
+        string location;
+        string backend;
+        SessionConfig config;
+    };
+
+    // bumped on every swap and rollback, so a version can be told apart from one that reuses its address
+    uint64_t generation = 0;
+
+    // guards previous, generation, pending, loading, queued and lastError
+    std::mutex swapLock;
+    std::shared_future<void> pending;
+    bool loading = false;
+    bool hasQueued = false;
+    LoadRequest queued;
+    string lastError;
+
+    // loads queued requests one after another until none are left
+    void loadQueued();
+
+public:
+    // constructor
+    ModelRegistry();
+    // destructor
+    ~ModelRegistry();
+
+    // start loading a version in the background, it becomes current once warmed up. Asking while a load runs queues it to run next
+    std::shared_future<void> load(string location, string backend = MaskBackend::backendFromEnvironment(), SessionConfig config = SessionConfig::fromEnvironment());
+    // block until the latest load finishes, rethrowing its error
+    void waitForLoad();
+    bool isLoading();
+
+    // the version new calls should run on, empty until the first load succeeds. generation is set to the version's generation when not null
+    std::shared_ptr<MaskBackend> acquire(uint64_t *generation = nullptr);
+    // swap back to the version that was current before the last swap
+    bool rollback();
+
+    string getCurrentLocation();
+    string getCurrentBackend();
+    string getPreviousLocation();
+    string getLastError();
+
+};
+
+#endif /* ModelRegistry_hpp */
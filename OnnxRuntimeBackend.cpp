@@ -0,0 +1,270 @@
+/**
+ * @file OnnxRuntimeBackend.cpp
+ * @brief Comprises the OnnxRuntimeBackend class. Every session gets an input and output buffer per power of two batch size up front, bound once with an IoBinding so steady state calls neither allocate nor look up names
+ * @bug Only built with CONFIG+=onnxruntime, which defines BIGBROTHER_WITH_ONNXRUNTIME
+ */
+
+/** -- Includes -- **/
+#include "OnnxRuntimeBackend.hpp"
+
+#ifdef BIGBROTHER_WITH_ONNXRUNTIME
+
+#include <algorithm>
+#include <stdexcept>
+#include <stdlib.h>
+
+#ifdef BIGBROTHER_WITH_ONNXRUNTIME_DNNL
+#include <dnnl_provider_factory.h>
+#endif
+
+/**
+ * @brief The ONNX Runtime environment has to outlive every session, so there is one for the whole process
+ */
+Ort::Env &OnnxRuntimeBackend::getEnvironment(){
+
+    static Ort::Env environment(ORT_LOGGING_LEVEL_WARNING, "BigBrother");
+
+    return environment;
+}
+
+/**
+ * @brief Maps the names used in environment.hpp to ONNX Runtime's levels
+ *
+ * @param name disable, basic, extended or all
+ */
+GraphOptimizationLevel OnnxRuntimeBackend::optimizationLevel(string name){
+
+    if(name == "disable"){
+        return ORT_DISABLE_ALL;
+    }
+    if(name == "basic"){
+        return ORT_ENABLE_BASIC;
+    }
+    if(name == "extended"){
+        return ORT_ENABLE_EXTENDED;
+    }
+    if(name == "all"){
+        return ORT_ENABLE_ALL;
+    }
+
+    throw std::runtime_error("Unknown ONNX Runtime optimization level " + name);
+}
+
+/**
+ * @brief Loads the model into MASK_SESSIONS sessions, allocates their buffers and warms each one up with a blank face
+ *
+ * @param location Path of the .onnx file
+ * @param config Number of sessions and the intra and inter op threads of each
+ */
+OnnxRuntimeBackend::OnnxRuntimeBackend(string location, SessionConfig config) : MaskBackend(location, config){
+
+    const char *optimization = getenv("BIGBROTHER_ORT_OPTIMIZATION");
+    const char *binding = getenv("BIGBROTHER_ORT_IO_BINDING");
+
+    this->ioBinding = binding && *binding ? atoi(binding) != 0 : MASK_ORT_IO_BINDING;
+
+    Ort::SessionOptions options;
+    options.SetGraphOptimizationLevel(optimizationLevel(optimization && *optimization ? optimization : MASK_ORT_OPTIMIZATION));
+    if(config.intraOpThreads > 0){
+        options.SetIntraOpNumThreads(config.intraOpThreads);
+    }
+    if(config.interOpThreads > 0){
+        options.SetInterOpNumThreads(config.interOpThreads);
+    }
+#ifdef BIGBROTHER_WITH_ONNXRUNTIME_DNNL
+    Ort::ThrowOnError(OrtSessionOptionsAppendExecutionProvider_Dnnl(options, 1));
+#endif
+
+    for(int i = 0; i < std::max(1, config.sessions); i++){
+        auto session = std::make_unique<Session>();
+        session->session = std::make_unique<Ort::Session>(getEnvironment(), location.c_str(), options);
+        this->sessions.push_back(std::move(session));
+    }
+
+    Ort::Session &first = *this->sessions[0]->session;
+    if(first.GetInputCount() != 1 || first.GetOutputCount() != 1){
+        throw std::runtime_error(location + " must have one input and one output");
+    }
+
+    Ort::AllocatorWithDefaultOptions allocator;
+    this->inputName = first.GetInputNameAllocated(0, allocator).get();
+    this->outputName = first.GetOutputNameAllocated(0, allocator).get();
+
+    vector<int64_t> inputShape = first.GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+    vector<int64_t> outputShape = first.GetOutputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+
+    if(first.GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT
+       || inputShape.size() != 4 || (inputShape[1] != 3 && inputShape[3] != 3)){
+        throw std::runtime_error(location + " does not take float batches of colour faces");
+    }
+    this->channelsFirst = inputShape[1] == 3;
+
+    this->classes = outputShape.empty() ? -1 : (int)outputShape.back();
+    if(this->classes < 2){
+        throw std::runtime_error(location + " must output a fixed number of classes");
+    }
+
+    for(const auto &session : this->sessions){
+        for(int batchSize = 1; batchSize <= MAX_BATCH_SIZE; batchSize *= 2){
+            session->slots.push_back(createSlot(session.get(), batchSize));
+        }
+    }
+
+    Mat blank(IMG_SIZE, IMG_SIZE, CV_8UC3, Scalar(0, 0, 0));
+    float probability;
+    for(const auto &session : this->sessions){
+        runSlot(session.get(), session->slots[0].get(), &blank, 1, &probability);
+    }
+
+}
+
+/** @brief destroys OnnxRuntimeBackend.
+ *
+ *  this just destroys the OnnxRuntimeBackend, each slot frees its buffers
+ *
+ */
+OnnxRuntimeBackend::~OnnxRuntimeBackend(){
+
+}
+
+/**
+ * @brief Allocates the input and output of one batch size and wraps them in Ort values, bound to the session when IO binding is on
+ *
+ * @param session Session the slot belongs to
+ * @param batchSize Number of faces the slot holds
+ * @return The new slot
+ */
+std::unique_ptr<OnnxRuntimeBackend::Slot> OnnxRuntimeBackend::createSlot(Session *session, int batchSize){
+
+    auto slot = std::make_unique<Slot>();
+    slot->batchSize = batchSize;
+
+    size_t inputCount = (size_t)batchSize * IMG_SIZE * IMG_SIZE * 3;
+    // aligned_alloc wants a multiple of the alignment
+    size_t bytes = (inputCount * sizeof(float) + 63) / 64 * 64;
+    slot->input.reset((float*)aligned_alloc(64, bytes));
+    slot->output.resize((size_t)batchSize * this->classes);
+
+    vector<int64_t> inputShape = this->channelsFirst
+        ? vector<int64_t>{batchSize, 3, IMG_SIZE, IMG_SIZE}
+        : vector<int64_t>{batchSize, IMG_SIZE, IMG_SIZE, 3};
+    vector<int64_t> outputShape = {batchSize, this->classes};
+
+    Ort::MemoryInfo memory = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+    slot->inputValue = Ort::Value::CreateTensor<float>(memory, slot->input.get(), inputCount, inputShape.data(), inputShape.size());
+    slot->outputValue = Ort::Value::CreateTensor<float>(memory, slot->output.data(), slot->output.size(), outputShape.data(), outputShape.size());
+
+    if(this->ioBinding){
+        slot->binding = std::make_unique<Ort::IoBinding>(*session->session);
+        slot->binding->BindInput(this->inputName.c_str(), slot->inputValue);
+        slot->binding->BindOutput(this->outputName.c_str(), slot->outputValue);
+    }
+
+    return slot;
+}
+
+string OnnxRuntimeBackend::getName(){
+
+    return "onnxruntime";
+}
+
+/**
+ * @brief Writes the faces into the slot's input in the model's layout, runs it and reads back the mask class
+ *
+ * @param session Session to run on
+ * @param slot Slot of the session, already locked by the caller
+ * @param faces Faces of BGR pixels
+ * @param count Number of faces, at most the slot's batch size
+ * @param probabilities Filled with the mask probability of each face
+ */
+void OnnxRuntimeBackend::runSlot(Session *session, Slot *slot, const Mat *faces, int count, float *probabilities){
+
+    size_t plane = (size_t)IMG_SIZE * IMG_SIZE;
+
+    for(int i = 0; i < count; i++){
+        float *data = slot->input.get() + i * plane * 3;
+
+        if(this->channelsFirst){
+            // convert to floats once, then split straight into the three planes of this face
+            slot->scratch.create(IMG_SIZE, IMG_SIZE, CV_32FC3);
+            packFace(faces[i], slot->scratch, 1.0 / 255.0, 0.0);
+
+            Mat planes[3] = {
+                Mat(IMG_SIZE, IMG_SIZE, CV_32FC1, data),
+                Mat(IMG_SIZE, IMG_SIZE, CV_32FC1, data + plane),
+                Mat(IMG_SIZE, IMG_SIZE, CV_32FC1, data + 2 * plane)
+            };
+            split(slot->scratch, planes);
+        }else{
+            Mat face(IMG_SIZE, IMG_SIZE, CV_32FC3, data);
+            packFace(faces[i], face, 1.0 / 255.0, 0.0);
+        }
+    }
+
+    const float *result;
+    vector<Ort::Value> outputs;
+
+    if(this->ioBinding){
+        session->session->Run(Ort::RunOptions{nullptr}, *slot->binding);
+        result = slot->output.data();
+    }else{
+        const char *inputNames[] = {this->inputName.c_str()};
+        const char *outputNames[] = {this->outputName.c_str()};
+        outputs = session->session->Run(Ort::RunOptions{nullptr}, inputNames, &slot->inputValue, 1, outputNames, 1);
+        result = outputs[0].GetTensorData<float>();
+    }
+
+    for(int i = 0; i < count; i++){
+        probabilities[i] = result[(size_t)i * this->classes + 1];
+    }
+
+}
+
+/**
+ * @brief Runs the faces on the least busy session, in the smallest slot that fits them
+ *
+ * @param faces Faces of BGR pixels
+ * @param count Number of faces, at most MAX_BATCH_SIZE
+ * @param probabilities Filled with the mask probability of each face
+ */
+void OnnxRuntimeBackend::run(const Mat *faces, int count, float *probabilities){
+
+    Session *chosen = this->sessions[0].get();
+    for(const auto &session : this->sessions){
+        if(session->busy.load(std::memory_order_relaxed) < chosen->busy.load(std::memory_order_relaxed)){
+            chosen = session.get();
+        }
+    }
+
+    int index = 0;
+    while(chosen->slots[index]->batchSize < count){
+        index++;
+    }
+    Slot *slot = chosen->slots[index].get();
+
+    chosen->busy++;
+    try {
+        std::lock_guard<std::mutex> lock(slot->lock);
+        runSlot(chosen, slot, faces, count, probabilities);
+    } catch (...) {
+        chosen->busy--;
+        throw;
+    }
+    chosen->busy--;
+
+}
+
+/**
+ * @brief Every buffer is allocated when the model loads, so this stays at the number of slots
+ */
+long OnnxRuntimeBackend::getInputSlots(){
+
+    long slots = 0;
+    for(const auto &session : this->sessions){
+        slots += session->slots.size();
+    }
+
+    return slots;
+}
+
+#endif /* BIGBROTHER_WITH_ONNXRUNTIME */
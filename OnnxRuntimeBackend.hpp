@@ -0,0 +1,78 @@
+/**
+ * @file OnnxRuntimeBackend.hpp
+ * @brief Header file for the OnnxRuntimeBackend class, which runs an ONNX export of the mask model through ONNX Runtime with configurable graph optimization, threading and IO binding
+ */
+
+#ifndef OnnxRuntimeBackend_hpp
+#define OnnxRuntimeBackend_hpp
+
+#ifdef BIGBROTHER_WITH_ONNXRUNTIME
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <onnxruntime_cxx_api.h>
+
+#include "MaskBackend.hpp"
+
+using namespace std;
+
+class OnnxRuntimeBackend : public MaskBackend
+{
+
+private:
+    // preallocated input and output for one batch size, used by a single call at a time
+    struct Slot {
+        std::mutex lock;
+        int batchSize;
+        // 64 byte aligned, released after the Ort values that point into it
+        std::unique_ptr<float, decltype(&free)> input{nullptr, free};
+        vector<float> output;
+        Ort::Value inputValue{nullptr};
+        Ort::Value outputValue{nullptr};
+        std::unique_ptr<Ort::IoBinding> binding;
+        // converted face before it is split into NCHW planes
+        Mat scratch;
+    };
+
+    // one session, with a slot per power of two batch size
+    struct Session {
+        std::unique_ptr<Ort::Session> session;
+        vector<std::unique_ptr<Slot>> slots;
+        std::atomic<int> busy{0};
+    };
+
+    vector<std::unique_ptr<Session>> sessions;
+    string inputName;
+    string outputName;
+    // the export from tools/export_onnx.py takes NCHW, a plain tf2onnx export NHWC
+    bool channelsFirst;
+    int classes;
+    bool ioBinding;
+
+    static Ort::Env &getEnvironment();
+    static GraphOptimizationLevel optimizationLevel(string name);
+
+    std::unique_ptr<Slot> createSlot(Session *session, int batchSize);
+    void runSlot(Session *session, Slot *slot, const Mat *faces, int count, float *probabilities);
+
+public:
+    // constructor, loads the model and warms up every session
+    OnnxRuntimeBackend(string location, SessionConfig config);
+    // destructor
+    ~OnnxRuntimeBackend();
+
+    string getName();
+    void run(const Mat *faces, int count, float *probabilities);
+    long getInputSlots();
+
+};
+
+#endif /* BIGBROTHER_WITH_ONNXRUNTIME */
+
+#endif /* OnnxRuntimeBackend_hpp */
@@ -0,0 +1,110 @@
+/**
+ * @file OpenCVBackend.cpp
+ * @brief Comprises the OpenCVBackend class. Faces are batched into an NCHW blob with blobFromImages and run on OpenCV's own CPU layers
+ * @bug OpenCV sizes one global thread pool, so intraOpThreads applies to the whole process rather than to each network
+ */
+
+/** -- Includes -- **/
+#include "OpenCVBackend.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Reads the model once per configured session and warms each copy up with a blank face
+ *
+ * @param location Path of a frozen .pb from tools/freeze_model.py or an .onnx from tools/export_onnx.py
+ * @param config sessions is the number of networks, intraOpThreads the size of OpenCV's thread pool
+ */
+OpenCVBackend::OpenCVBackend(string location, SessionConfig config) : MaskBackend(location, config){
+
+    this->nextNetwork = 0;
+
+    if(config.intraOpThreads > 0){
+        setNumThreads(config.intraOpThreads);
+    }
+
+    for(int i = 0; i < std::max(1, config.sessions); i++){
+
+        auto network = std::make_unique<Network>();
+        network->net = dnn::readNet(location);
+        if(network->net.empty()){
+            throw std::runtime_error("Unable to read " + location);
+        }
+        network->net.setPreferableBackend(dnn::DNN_BACKEND_OPENCV);
+        network->net.setPreferableTarget(dnn::DNN_TARGET_CPU);
+
+        this->networks.push_back(std::move(network));
+    }
+
+    Mat blank(IMG_SIZE, IMG_SIZE, CV_8UC3, Scalar(0, 0, 0));
+    float probability;
+    for(const auto &network : this->networks){
+        runLocked(network.get(), &blank, 1, &probability);
+    }
+
+}
+
+/** @brief destroys OpenCVBackend.
+ *
+ *  this just destroys the OpenCVBackend
+ *
+ */
+OpenCVBackend::~OpenCVBackend(){
+
+}
+
+string OpenCVBackend::getName(){
+
+    return "opencv";
+}
+
+/**
+ * @brief Packs the faces into the network's blob, runs it and reads back the mask class
+ *
+ * @param network Network already locked by the caller
+ * @param faces Faces of BGR pixels, resized to IMG_SIZE x IMG_SIZE by blobFromImages
+ * @param count Number of faces, at most MAX_BATCH_SIZE
+ * @param probabilities Filled with the mask probability of each face
+ */
+void OpenCVBackend::runLocked(Network *network, const Mat *faces, int count, float *probabilities){
+
+    network->batch.assign(faces, faces + count);
+
+    // scale to 0-1 and keep BGR like the other backends, the blob is only reallocated when the batch size changes
+    dnn::blobFromImages(network->batch, network->blob, 1.0 / 255.0, Size(IMG_SIZE, IMG_SIZE), Scalar(), false, false, CV_32F);
+
+    network->net.setInput(network->blob);
+    Mat output = network->net.forward();
+
+    // N x classes, anything else is flattened to that
+    output = output.reshape(1, count);
+
+    for(int i = 0; i < count; i++){
+        probabilities[i] = output.at<float>(i, 1);
+    }
+
+}
+
+/**
+ * @brief Runs the faces on the first idle network, or queues on one in turn when every network is busy
+ *
+ * @param faces Faces of BGR pixels
+ * @param count Number of faces, at most MAX_BATCH_SIZE
+ * @param probabilities Filled with the mask probability of each face
+ */
+void OpenCVBackend::run(const Mat *faces, int count, float *probabilities){
+
+    for(const auto &network : this->networks){
+        std::unique_lock<std::mutex> lock(network->lock, std::try_to_lock);
+        if(lock.owns_lock()){
+            runLocked(network.get(), faces, count, probabilities);
+            return;
+        }
+    }
+
+    Network *network = this->networks[this->nextNetwork++ % this->networks.size()].get();
+    std::lock_guard<std::mutex> lock(network->lock);
+    runLocked(network, faces, count, probabilities);
+
+}
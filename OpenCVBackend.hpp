@@ -0,0 +1,53 @@
+/**
+ * @file OpenCVBackend.hpp
+ * @brief Header file for the OpenCVBackend class, which runs a frozen graph or ONNX export of the mask model through OpenCV's dnn module so small devices can skip libtensorflow
+ */
+
+#ifndef OpenCVBackend_hpp
+#define OpenCVBackend_hpp
+
+#include <stdio.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <opencv2/dnn.hpp>
+
+#include "MaskBackend.hpp"
+
+using namespace std;
+
+class OpenCVBackend : public MaskBackend
+{
+
+private:
+    // a Net keeps per-forward state, so each one is used by a single call at a time
+    struct Network {
+        std::mutex lock;
+        dnn::Net net;
+        // NCHW input, reused while the batch size stays the same
+        Mat blob;
+        vector<Mat> batch;
+    };
+
+    vector<std::unique_ptr<Network>> networks;
+    // where to queue once every network is busy
+    std::atomic<unsigned> nextNetwork;
+
+    // runs count faces on a network that is already locked
+    void runLocked(Network *network, const Mat *faces, int count, float *probabilities);
+
+public:
+    // constructor, reads the model and warms up every network
+    OpenCVBackend(string location, SessionConfig config);
+    // destructor
+    ~OpenCVBackend();
+
+    string getName();
+    void run(const Mat *faces, int count, float *probabilities);
+
+};
+
+#endif /* OpenCVBackend_hpp */
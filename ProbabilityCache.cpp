@@ -0,0 +1,253 @@
+/**
+ * @file ProbabilityCache.cpp
+ * @brief Comprises the ProbabilityCache class. A hit is any entry within the Hamming tolerance of the face's dHash, found by scanning the entries since a few hundred popcounts cost far less than an inference
+ * @bug Two different people with similar framing and lighting can collide at high tolerances, the sampled verification error shows when that happens
+ */
+
+/** -- Includes -- **/
+#include "ProbabilityCache.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructor for ProbabilityCache
+ *
+ * @param capacity Number of faces remembered, 0 turns the cache off
+ * @param tolerance Largest number of differing hash bits that still counts as the same face
+ * @param verifyEvery Every n-th hit is also run through the model to measure the error, 0 never verifies
+ */
+ProbabilityCache::ProbabilityCache(size_t capacity, int tolerance, int verifyEvery){
+
+    this->capacity = capacity;
+    this->tolerance = tolerance;
+    this->verifyEvery = verifyEvery;
+    resetStats();
+
+}
+
+/** @brief destroys ProbabilityCache.
+ *
+ *  this just destroys the ProbabilityCache
+ *
+ */
+ProbabilityCache::~ProbabilityCache(){
+
+}
+
+/**
+ * @brief Difference hash, one bit per pair of neighbouring pixels of the face shrunk to 9x8 grey levels
+ *
+ * @param face Face of BGR pixels, any size
+ * @return The hash
+ */
+uint64_t ProbabilityCache::hash(const Mat &face){
+
+    Mat grey;
+    cvtColor(face, grey, COLOR_BGR2GRAY);
+
+    Mat small;
+    resize(grey, small, Size(9, 8), 0, 0, INTER_AREA);
+
+    uint64_t bits = 0;
+    for(int y = 0; y < 8; y++){
+        const uchar *row = small.ptr<uchar>(y);
+        for(int x = 0; x < 8; x++){
+            bits = (bits << 1) | (row[x] < row[x + 1]);
+        }
+    }
+
+    return bits;
+}
+
+/**
+ * @brief Finds the closest entry within the tolerance and moves it to the front
+ *
+ * @param hash Hash of the face
+ * @param probability Set to the cached probability on a hit
+ * @param verify Set when the caller should run the model anyway and report back with recordVerification
+ * @return True on a hit
+ */
+bool ProbabilityCache::lookup(uint64_t hash, float &probability, bool &verify){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    this->lookups++;
+    verify = false;
+
+    auto best = this->entries.end();
+    int bestDistance = this->tolerance + 1;
+
+    for(auto entry = this->entries.begin(); entry != this->entries.end(); entry++){
+        int distance = __builtin_popcountll(entry->hash ^ hash);
+        if(distance < bestDistance){
+            best = entry;
+            bestDistance = distance;
+            if(distance == 0){
+                break;
+            }
+        }
+    }
+
+    if(best == this->entries.end()){
+        return false;
+    }
+
+    this->entries.splice(this->entries.begin(), this->entries, best);
+    this->hits++;
+
+    probability = best->probability;
+    verify = this->verifyEvery > 0 && this->hits % this->verifyEvery == 0;
+
+    return true;
+}
+
+/**
+ * @brief Remembers a probability, replacing an entry with the same hash or dropping the least recently used one when full
+ */
+void ProbabilityCache::insert(uint64_t hash, float probability){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    if(this->capacity == 0){
+        return;
+    }
+
+    for(auto entry = this->entries.begin(); entry != this->entries.end(); entry++){
+        if(entry->hash == hash){
+            entry->probability = probability;
+            this->entries.splice(this->entries.begin(), this->entries, entry);
+            return;
+        }
+    }
+
+    this->entries.push_front({hash, probability});
+    while(this->entries.size() > this->capacity){
+        this->entries.pop_back();
+    }
+
+}
+
+/**
+ * @brief Records how far a cached probability was from the model's
+ */
+void ProbabilityCache::recordVerification(float cached, float fresh){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    double error = std::fabs(cached - fresh);
+    this->verified++;
+    this->totalError += error;
+    this->maxError = std::max(this->maxError, error);
+
+}
+
+/**
+ * @brief Forgets every face, needed when the model changes
+ */
+void ProbabilityCache::clear(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    this->entries.clear();
+
+}
+
+void ProbabilityCache::resetStats(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    this->lookups = 0;
+    this->hits = 0;
+    this->verified = 0;
+    this->totalError = 0.0;
+    this->maxError = 0.0;
+
+}
+
+bool ProbabilityCache::isEnabled(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->capacity > 0;
+}
+
+void ProbabilityCache::setCapacity(size_t capacity){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    this->capacity = capacity;
+    while(this->entries.size() > capacity){
+        this->entries.pop_back();
+    }
+
+}
+
+void ProbabilityCache::setTolerance(int tolerance){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    this->tolerance = tolerance;
+}
+
+size_t ProbabilityCache::getCapacity(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->capacity;
+}
+
+int ProbabilityCache::getTolerance(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->tolerance;
+}
+
+size_t ProbabilityCache::getSize(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->entries.size();
+}
+
+long ProbabilityCache::getLookups(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->lookups;
+}
+
+/**
+ * @return Fraction of lookups answered from the cache, 0 before the first lookup
+ */
+float ProbabilityCache::getHitRate(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->lookups ? (float)this->hits / this->lookups : 0.f;
+}
+
+long ProbabilityCache::getVerified(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->verified;
+}
+
+/**
+ * @return Mean absolute difference between verified hits and the model, 0 before the first verification
+ */
+float ProbabilityCache::getMeanError(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->verified ? (float)(this->totalError / this->verified) : 0.f;
+}
+
+float ProbabilityCache::getMaxError(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return (float)this->maxError;
+}
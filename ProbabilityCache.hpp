@@ -0,0 +1,73 @@
+/**
+ * @file ProbabilityCache.hpp
+ * @brief Header file for the ProbabilityCache class, an LRU cache of mask probabilities keyed on a perceptual hash of the face so a person standing still is not re-inferred every frame
+ */
+
+#ifndef ProbabilityCache_hpp
+#define ProbabilityCache_hpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <list>
+#include <mutex>
+
+#include "opencv.hpp"
+#include "environment.hpp"
+
+using namespace cv;
+using namespace std;
+
+class ProbabilityCache
+{
+
+private:
+    struct Entry {
+        uint64_t hash;
+        float probability;
+    };
+
+    // most recently used first
+    list<Entry> entries;
+    size_t capacity;
+    int tolerance;
+    int verifyEvery;
+    std::mutex lock;
+
+    long lookups;
+    long hits;
+    long verified;
+    double totalError;
+    double maxError;
+
+public:
+    // constructor, capacity 0 turns the cache off
+    ProbabilityCache(size_t capacity, int tolerance, int verifyEvery);
+    // destructor
+    ~ProbabilityCache();
+
+    // 64 bit difference hash of a face, near identical crops differ in a few bits
+    static uint64_t hash(const Mat &face);
+
+    // probability of the closest entry within the tolerance, verify is set when this hit should be checked against the model
+    bool lookup(uint64_t hash, float &probability, bool &verify);
+    void insert(uint64_t hash, float probability);
+    // compare a cached probability with the model's for the same face
+    void recordVerification(float cached, float fresh);
+    void clear();
+    void resetStats();
+
+    bool isEnabled();
+    void setCapacity(size_t capacity);
+    void setTolerance(int tolerance);
+    size_t getCapacity();
+    int getTolerance();
+    size_t getSize();
+    long getLookups();
+    float getHitRate();
+    long getVerified();
+    float getMeanError();
+    float getMaxError();
+
+};
+
+#endif /* ProbabilityCache_hpp */
@@ -0,0 +1,126 @@
+/**
+ * @file ProbabilityStore.cpp
+ * @brief Comprises the ProbabilityStore class. The whole session fits in PROBABILITY_BINS counters, and recounting for a new sensitivity is one pass over them
+ * @bug The split happens at the nearest bin edge, so a probability less than one bin above the sensitivity can be counted on the wrong side
+ */
+
+/** -- Includes -- **/
+#include "ProbabilityStore.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructor for ProbabilityStore, starts empty
+ */
+ProbabilityStore::ProbabilityStore(){
+
+    this->bins.assign(PROBABILITY_BINS, 0);
+    this->total = 0;
+
+}
+
+/** @brief destroys ProbabilityStore.
+ *
+ *  this just destroys the ProbabilityStore
+ *
+ */
+ProbabilityStore::~ProbabilityStore(){
+
+}
+
+/**
+ * @brief Index of the bin a probability falls in, values outside 0-1 go to the first or last bin
+ */
+static int binOf(float probability, int bins){
+
+    return std::min(bins - 1, std::max(0, (int)(probability * bins)));
+}
+
+/**
+ * @brief Records one counted face
+ *
+ * @param probability Mask probability of the face
+ */
+void ProbabilityStore::add(float probability){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    this->bins[binOf(probability, PROBABILITY_BINS)]++;
+    this->total++;
+
+}
+
+/**
+ * @brief Splits every recorded face at a sensitivity, as if it had been set from the start
+ *
+ * @param sensitivity Probability a face needs to exceed to count as wearing a mask
+ * @param withMask Set to the faces above the sensitivity
+ * @param withoutMask Set to the rest
+ */
+void ProbabilityStore::count(float sensitivity, long &withMask, long &withoutMask){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    int first = firstMaskedBin(sensitivity);
+
+    withoutMask = 0;
+    for(int i = 0; i < first; i++){
+        withoutMask += this->bins[i];
+    }
+    withMask = this->total - withoutMask;
+
+}
+
+/**
+ * @brief Splits every recorded face at a sensitivity like count, then groups the bins into fewer, wider ones
+ *
+ * The group the sensitivity falls in is split along the fine bins, so the groups add up to exactly what count reports
+ *
+ * @param groups Number of equal groups over 0-1, at most PROBABILITY_BINS
+ * @param sensitivity Probability a face needs to exceed to count as wearing a mask
+ * @param withMask Set to the faces above the sensitivity in each group
+ * @param withoutMask Set to the rest in each group
+ */
+void ProbabilityStore::histogram(int groups, float sensitivity, vector<long> &withMask, vector<long> &withoutMask){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    int first = firstMaskedBin(sensitivity);
+
+    withMask.assign(groups, 0);
+    withoutMask.assign(groups, 0);
+    for(int i = 0; i < PROBABILITY_BINS; i++){
+        int group = (int)((long)i * groups / PROBABILITY_BINS);
+        if(i < first){
+            withoutMask[group] += this->bins[i];
+        }else{
+            withMask[group] += this->bins[i];
+        }
+    }
+
+}
+
+/**
+ * @brief First bin starting at or above the sensitivity, the small slack keeps 0.2 * 1000 from rounding up to 201
+ */
+int ProbabilityStore::firstMaskedBin(float sensitivity){
+
+    return std::min(PROBABILITY_BINS, std::max(0, (int)std::ceil(sensitivity * PROBABILITY_BINS - 1e-3)));
+}
+
+long ProbabilityStore::getTotal(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return this->total;
+}
+
+void ProbabilityStore::clear(){
+
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    std::fill(this->bins.begin(), this->bins.end(), 0);
+    this->total = 0;
+
+}
@@ -0,0 +1,46 @@
+/**
+ * @file ProbabilityStore.hpp
+ * @brief Header file for the ProbabilityStore class, a histogram of every counted face's mask probability so compliance can be recomputed for any sensitivity without running the model again
+ */
+
+#ifndef ProbabilityStore_hpp
+#define ProbabilityStore_hpp
+
+#include <stdio.h>
+#include <mutex>
+#include <vector>
+
+#include "environment.hpp"
+
+using namespace std;
+
+class ProbabilityStore
+{
+
+private:
+    // PROBABILITY_BINS equal bins over 0-1
+    vector<long> bins;
+    long total;
+    // the pipeline adds while the UI recounts and draws
+    std::mutex lock;
+
+    // first bin that counts as wearing a mask at a sensitivity
+    static int firstMaskedBin(float sensitivity);
+
+public:
+    // constructor
+    ProbabilityStore();
+    // destructor
+    ~ProbabilityStore();
+
+    void add(float probability);
+    // faces above and at or below the sensitivity, to the resolution of one bin
+    void count(float sensitivity, long &withMask, long &withoutMask);
+    // the same split grouped into fewer bins for drawing and export, the totals always match count
+    void histogram(int groups, float sensitivity, vector<long> &withMask, vector<long> &withoutMask);
+    long getTotal();
+    void clear();
+
+};
+
+#endif /* ProbabilityStore_hpp */
@@ -10,6 +10,8 @@ Report::Report(int people, float compliance){
 
     this->people = people;
     this->compliance = compliance;
+    this->histogram = nullptr;
+    this->sensitivity = 0.f;
     
     // get the file output folder from the environment variables
     const char* rootFolder = OUTPUT_FOLDER;
@@ -44,6 +46,15 @@ string Report::getOutputLocation(){
     return outputLocation;
 }
 
+void Report::setHistogram(ProbabilityStore *histogram, float sensitivity){
+    this->histogram = histogram;
+    this->sensitivity = sensitivity;
+}
+
+void Report::setStartupTimings(string rows){
+    this->startupTimings = rows;
+}
+
 void Report::exportFile(){
 
     std::ofstream exportReport;
@@ -62,6 +73,28 @@ void Report::exportFile(){
     exportReport << compliance;
     exportReport << "\n";
 
+    // add the probability histogram, one row per bin, split at the sensitivity the compliance was counted at
+    if(histogram){
+        vector<long> withMask;
+        vector<long> withoutMask;
+        histogram->histogram(MASK_HISTOGRAM_BINS, sensitivity, withMask, withoutMask);
+
+        exportReport << "\n";
+        exportReport << "Sensitivity,";
+        exportReport << sensitivity;
+        exportReport << "\n";
+        exportReport << "Probability,With Mask,Without Mask\n";
+        for(int i = 0; i < MASK_HISTOGRAM_BINS; i++){
+            exportReport << (float)i / MASK_HISTOGRAM_BINS << "," << withMask[i] << "," << withoutMask[i] << "\n";
+        }
+    }
+
+    // add the startup timings so slow cold starts on a device can be looked into later
+    if(!startupTimings.empty()){
+        exportReport << "\n";
+        exportReport << startupTimings;
+    }
+
     exportReport.close();
 
 }
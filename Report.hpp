@@ -12,6 +12,7 @@
 #include <time.h>
 #include "environment.hpp"
 #include "opencv.hpp"
+#include "ProbabilityStore.hpp"
 
 using namespace std;
 using namespace cv;
@@ -24,6 +25,9 @@ private:
     float compliance;
     string outputLocation;
     string dateTime;
+    ProbabilityStore *histogram;
+    float sensitivity;
+    string startupTimings;
     
 public:
     // constructor
@@ -34,6 +38,10 @@ public:
     
     string getOutputLocation();
     void setOutputLocation(string);
+    // include the probability histogram in the export, split at the sensitivity
+    void setHistogram(ProbabilityStore *histogram, float sensitivity);
+    // include how long each startup step took, as comma separated rows
+    void setStartupTimings(string rows);
     
 };
 
@@ -0,0 +1,251 @@
+/**
+ * @file Startup.cpp
+ * @brief Comprises the Startup class, which runs the slow initialization steps side by side instead of one after another and reports how long each took
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "Startup.hpp"
+#include "FaceDetector.hpp"
+#include "MaskDetector.hpp"
+
+#include <algorithm>
+
+Startup* Startup::instance = nullptr;
+
+/**
+ * @brief Constructor for Startup, the launch time everything is measured against is taken here
+ */
+Startup::Startup(){
+
+    this->launchTime = std::chrono::steady_clock::now();
+    this->firstFrameMs = -1.0;
+    this->firstResultMs = -1.0;
+}
+
+/** @brief destroys Startup.
+ *
+ *  this just destroys the Startup
+ *
+ */
+Startup::~Startup(){
+
+}
+
+/**
+ * @brief Returns the singleton class object for Startup
+ *
+ * @return Startup Singleton
+ */
+Startup* Startup::getInstance(){
+
+    if(!Startup::instance){
+        Startup::instance = new Startup();
+    }
+
+    return Startup::instance;
+}
+
+/**
+ * @brief Runs one step on its own thread, recording when it started and finished
+ *
+ * @param name Name shown in the report
+ * @param work The initialization to perform
+ * @return Future that resolves when the step is done
+ */
+std::shared_future<void> Startup::runStep(string name, std::function<void()> work){
+
+    return std::async(std::launch::async, [this, name, work](){
+
+        Step step;
+        step.name = name;
+        step.startMs = msSinceLaunch();
+
+        try {
+            work();
+        } catch (const std::exception &e) {
+            step.error = e.what();
+        }
+
+        step.endMs = msSinceLaunch();
+
+        std::lock_guard<std::mutex> lock(stepsLock);
+        steps.push_back(step);
+
+    }).share();
+}
+
+/**
+ * @brief Checks a step without blocking
+ */
+bool Startup::isDone(const std::shared_future<void> &step){
+    return step.valid() && step.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+/**
+ * @brief Starts the camera, face cascade and mask model concurrently, returning straight away so the window can show
+ */
+void Startup::begin(){
+
+    // singletons are created here on the calling thread so the workers never race to construct them, the model load itself waits for its step
+    MaskDetector *maskDetector = MaskDetector::getInstance(false);
+
+    this->cameraReady = runStep("camera", [this](){
+        camera.open(0);
+        camera >> firstFrame;
+    });
+
+    this->faceDetectorReady = runStep("face cascade", [](){
+        FaceDetector::getInstance();
+    });
+
+    // started inside the step so the timing covers the whole load and warm up
+    this->maskModelReady = runStep("mask model", [maskDetector](){
+        maskDetector->loadDefaultModel();
+        maskDetector->waitForModel();
+    });
+}
+
+bool Startup::isCameraReady(){
+    return isDone(this->cameraReady);
+}
+
+bool Startup::isFaceDetectorReady(){
+    return isDone(this->faceDetectorReady);
+}
+
+bool Startup::isMaskModelReady(){
+    return isDone(this->maskModelReady);
+}
+
+/**
+ * @return True once every step has finished, successfully or not
+ */
+bool Startup::isComplete(){
+    return isCameraReady() && isFaceDetectorReady() && isMaskModelReady();
+}
+
+/**
+ * @brief Gives access to the camera, only valid once isCameraReady returns true
+ */
+VideoCapture &Startup::getCamera(){
+    return this->camera;
+}
+
+/**
+ * @brief The frame grabbed while opening the camera, only valid once isCameraReady returns true
+ */
+Mat Startup::getFirstFrame(){
+    return this->firstFrame;
+}
+
+/**
+ * @return Milliseconds elapsed since startup began
+ */
+double Startup::msSinceLaunch(){
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - launchTime).count();
+}
+
+/**
+ * @brief Records when the first camera frame reached the UI, later calls are ignored
+ */
+void Startup::markFirstFrame(){
+    if(this->firstFrameMs < 0){
+        this->firstFrameMs = msSinceLaunch();
+    }
+}
+
+/**
+ * @brief Records when the first mask result reached the UI, later calls are ignored
+ */
+void Startup::markFirstResult(){
+    if(this->firstResultMs < 0){
+        this->firstResultMs = msSinceLaunch();
+    }
+}
+
+double Startup::getFirstFrameMs(){
+    return this->firstFrameMs;
+}
+
+double Startup::getFirstResultMs(){
+    return this->firstResultMs;
+}
+
+/**
+ * @brief Builds a table of every finished step, plus how long startup would have taken running them one after another
+ *
+ * @return The report as printable text
+ */
+string Startup::getReport(){
+
+    vector<Step> finished;
+    {
+        std::lock_guard<std::mutex> lock(stepsLock);
+        finished = steps;
+    }
+
+    std::sort(finished.begin(), finished.end(), [](const Step &a, const Step &b){
+        return a.startMs < b.startMs;
+    });
+
+    string report = "Startup timings (ms since launch)\n";
+
+    double serialMs = 0.0;
+    double doneMs = 0.0;
+
+    for(const Step &step : finished){
+        report += format("  %-14s %8.1f -> %8.1f  %8.1f ms", step.name.c_str(), step.startMs, step.endMs, step.endMs - step.startMs);
+        if(!step.error.empty()){
+            report += "  failed: " + step.error;
+        }
+        report += "\n";
+
+        serialMs += step.endMs - step.startMs;
+        doneMs = std::max(doneMs, step.endMs);
+    }
+
+    report += format("  all steps done at %.1f ms, %.1f ms if run one after another\n", doneMs, serialMs);
+
+    if(this->firstFrameMs >= 0){
+        report += format("  first frame at %.1f ms\n", this->firstFrameMs);
+    }
+    if(this->firstResultMs >= 0){
+        report += format("  first result at %.1f ms\n", this->firstResultMs);
+    }
+
+    return report;
+}
+
+/**
+ * @brief The same timings as getReport, as rows that can go into the exported compliance report
+ *
+ * @return Comma separated rows, one per finished step and milestone
+ */
+string Startup::getReportRows(){
+
+    vector<Step> finished;
+    {
+        std::lock_guard<std::mutex> lock(stepsLock);
+        finished = steps;
+    }
+
+    std::sort(finished.begin(), finished.end(), [](const Step &a, const Step &b){
+        return a.startMs < b.startMs;
+    });
+
+    string rows = "Startup Step,Start ms,End ms,Duration ms,Error\n";
+
+    for(const Step &step : finished){
+        rows += format("%s,%.1f,%.1f,%.1f,%s\n", step.name.c_str(), step.startMs, step.endMs, step.endMs - step.startMs, step.error.c_str());
+    }
+
+    if(this->firstFrameMs >= 0){
+        rows += format("first frame,,%.1f,,\n", this->firstFrameMs);
+    }
+    if(this->firstResultMs >= 0){
+        rows += format("first result,,%.1f,,\n", this->firstResultMs);
+    }
+
+    return rows;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file Startup.hpp
+ * @brief Header file for the Startup class, which brings up the camera, face detector and mask model concurrently and times each step
+ */
+
+#ifndef Startup_hpp
+#define Startup_hpp
+
+#include <stdio.h>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "opencv.hpp"
+#include "environment.hpp"
+
+using namespace cv;
+using namespace std;
+
+class Startup
+{
+
+private:
+    // timing for a single initialization step
+    struct Step {
+        string name;
+        double startMs;
+        double endMs;
+        string error;
+    };
+
+    std::chrono::steady_clock::time_point launchTime;
+
+    // the camera is owned here so it is never opened as a static side effect
+    VideoCapture camera;
+    Mat firstFrame;
+
+    std::shared_future<void> cameraReady;
+    std::shared_future<void> faceDetectorReady;
+    std::shared_future<void> maskModelReady;
+
+    std::mutex stepsLock;
+    vector<Step> steps;
+
+    double firstFrameMs;
+    double firstResultMs;
+
+    // helper to run and time a step on its own thread
+    std::shared_future<void> runStep(string name, std::function<void()> work);
+    static bool isDone(const std::shared_future<void> &step);
+
+public:
+    static Startup *instance;
+
+    // constructor
+    Startup();
+    // destructor
+    ~Startup();
+
+    // singleton getter
+    static Startup *getInstance();
+
+    // kick off every step, returns immediately
+    void begin();
+
+    bool isCameraReady();
+    bool isFaceDetectorReady();
+    bool isMaskModelReady();
+    bool isComplete();
+
+    VideoCapture &getCamera();
+    Mat getFirstFrame();
+
+    // milestones after the steps, recorded by the UI
+    double msSinceLaunch();
+    void markFirstFrame();
+    void markFirstResult();
+    double getFirstFrameMs();
+    double getFirstResultMs();
+
+    string getReport();
+    // the timings as comma separated rows for the exported report
+    string getReportRows();
+
+};
+
+#endif /* Startup_hpp */
@@ -0,0 +1,216 @@
+/**
+ * @file TFLiteBackend.cpp
+ * @brief Comprises the TFLiteBackend class. Each interpreter owns an XNNPACK delegate and its input is resized to the next power of two batch, quantized models are fed and read through their scale and zero point
+ * @bug Only built with CONFIG+=tflite, which defines BIGBROTHER_WITH_TFLITE
+ */
+
+/** -- Includes -- **/
+#include "TFLiteBackend.hpp"
+
+#ifdef BIGBROTHER_WITH_TFLITE
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Loads the model and creates one interpreter per configured session, each warmed up with a blank face
+ *
+ * @param location Path of the .tflite file
+ * @param config sessions is the number of interpreters and intraOpThreads the threads each one (and its delegate) uses
+ */
+TFLiteBackend::TFLiteBackend(string location, SessionConfig config) : MaskBackend(location, config){
+
+    this->nextInterpreter = 0;
+    this->model = TfLiteModelCreateFromFile(location.c_str());
+    if(!this->model){
+        throw std::runtime_error("Unable to load " + location);
+    }
+
+    int threads = config.intraOpThreads > 0 ? config.intraOpThreads : 1;
+
+    try {
+        for(int i = 0; i < std::max(1, config.sessions); i++){
+
+            auto interpreter = std::make_unique<Interpreter>();
+
+            TfLiteXNNPackDelegateOptions delegateOptions = TfLiteXNNPackDelegateOptionsDefault();
+            delegateOptions.num_threads = threads;
+            interpreter->delegate = TfLiteXNNPackDelegateCreate(&delegateOptions);
+
+            TfLiteInterpreterOptions *options = TfLiteInterpreterOptionsCreate();
+            TfLiteInterpreterOptionsSetNumThreads(options, threads);
+            TfLiteInterpreterOptionsAddDelegate(options, interpreter->delegate);
+            interpreter->interpreter = TfLiteInterpreterCreate(this->model, options);
+            TfLiteInterpreterOptionsDelete(options);
+            interpreter->batchSize = 0;
+
+            // pushed before checking so release() frees the delegate either way
+            this->interpreters.push_back(std::move(interpreter));
+            if(!this->interpreters.back()->interpreter){
+                throw std::runtime_error("Unable to create an interpreter for " + location);
+            }
+        }
+
+        const TfLiteTensor *input = TfLiteInterpreterGetInputTensor(this->interpreters[0]->interpreter, 0);
+        if(TfLiteInterpreterGetInputTensorCount(this->interpreters[0]->interpreter) != 1
+           || TfLiteTensorNumDims(input) != 4 || TfLiteTensorDim(input, 3) != 3){
+            throw std::runtime_error(location + " does not take batches of colour faces");
+        }
+
+        Mat blank(IMG_SIZE, IMG_SIZE, CV_8UC3, Scalar(0, 0, 0));
+        float probability;
+        for(const auto &interpreter : this->interpreters){
+            runLocked(interpreter.get(), &blank, 1, &probability);
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+
+}
+
+/** @brief destroys TFLiteBackend.
+ *
+ *  the interpreters go before the delegates they use, and the model last
+ *
+ */
+TFLiteBackend::~TFLiteBackend(){
+
+    release();
+
+}
+
+void TFLiteBackend::release(){
+
+    for(const auto &interpreter : this->interpreters){
+        if(interpreter->interpreter){
+            TfLiteInterpreterDelete(interpreter->interpreter);
+        }
+        TfLiteXNNPackDelegateDelete(interpreter->delegate);
+    }
+    this->interpreters.clear();
+
+    if(this->model){
+        TfLiteModelDelete(this->model);
+        this->model = nullptr;
+    }
+
+}
+
+string TFLiteBackend::getName(){
+
+    return "tflite";
+}
+
+/**
+ * @brief Writes the faces into the interpreter's input tensor, runs it and reads back the mask class
+ *
+ * @param interpreter Interpreter already locked by the caller
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @param count Number of faces, at most MAX_BATCH_SIZE
+ * @param probabilities Filled with the mask probability of each face
+ */
+void TFLiteBackend::runLocked(Interpreter *interpreter, const Mat *faces, int count, float *probabilities){
+
+    // resizing reallocates the tensors, so only do it when the power of two batch changes
+    int batchSize = 1;
+    while(batchSize < count){
+        batchSize *= 2;
+    }
+
+    if(batchSize != interpreter->batchSize){
+        int dims[4] = {batchSize, IMG_SIZE, IMG_SIZE, 3};
+        if(TfLiteInterpreterResizeInputTensor(interpreter->interpreter, 0, dims, 4) != kTfLiteOk
+           || TfLiteInterpreterAllocateTensors(interpreter->interpreter) != kTfLiteOk){
+            throw std::runtime_error("Unable to resize " + this->location + " to a batch of " + std::to_string(batchSize));
+        }
+        interpreter->batchSize = batchSize;
+    }
+
+    TfLiteTensor *input = TfLiteInterpreterGetInputTensor(interpreter->interpreter, 0);
+    TfLiteQuantizationParams inputQuantization = TfLiteTensorQuantizationParams(input);
+
+    // float models take pixels scaled to 0-1, quantized ones the same value through their scale and zero point
+    int slotType;
+    double scale = 1.0 / 255.0;
+    double offset = 0.0;
+
+    switch(TfLiteTensorType(input)){
+        case kTfLiteFloat32:
+            slotType = CV_32FC3;
+            break;
+        case kTfLiteUInt8:
+        case kTfLiteInt8:
+            slotType = TfLiteTensorType(input) == kTfLiteUInt8 ? CV_8UC3 : CV_8SC3;
+            if(inputQuantization.scale > 0.f){
+                scale = 1.0 / (255.0 * inputQuantization.scale);
+                offset = inputQuantization.zero_point;
+            }else{
+                // unquantized bytes, the model normalizes inside the graph
+                scale = 1.0;
+            }
+            break;
+        default:
+            throw std::runtime_error(this->location + " has an unsupported input type");
+    }
+
+    size_t faceBytes = (size_t)IMG_SIZE * IMG_SIZE * CV_ELEM_SIZE(slotType);
+    uchar *data = (uchar*)TfLiteTensorData(input);
+
+    for(int i = 0; i < count; i++){
+        Mat slot(IMG_SIZE, IMG_SIZE, slotType, data + i * faceBytes);
+        packFace(faces[i], slot, scale, offset);
+    }
+
+    if(TfLiteInterpreterInvoke(interpreter->interpreter) != kTfLiteOk){
+        throw std::runtime_error("Unable to run " + this->location);
+    }
+
+    const TfLiteTensor *output = TfLiteInterpreterGetOutputTensor(interpreter->interpreter, 0);
+    int classes = TfLiteTensorDim(output, TfLiteTensorNumDims(output) - 1);
+    TfLiteQuantizationParams outputQuantization = TfLiteTensorQuantizationParams(output);
+    const void *result = TfLiteTensorData(output);
+
+    for(int i = 0; i < count; i++){
+        size_t index = (size_t)i * classes + 1;
+        switch(TfLiteTensorType(output)){
+            case kTfLiteFloat32:
+                probabilities[i] = ((const float*)result)[index];
+                break;
+            case kTfLiteUInt8:
+                probabilities[i] = (((const uint8_t*)result)[index] - outputQuantization.zero_point) * outputQuantization.scale;
+                break;
+            case kTfLiteInt8:
+                probabilities[i] = (((const int8_t*)result)[index] - outputQuantization.zero_point) * outputQuantization.scale;
+                break;
+            default:
+                throw std::runtime_error(this->location + " has an unsupported output type");
+        }
+    }
+
+}
+
+/**
+ * @brief Runs the faces on the first idle interpreter, or queues on one in turn when every interpreter is busy
+ *
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @param count Number of faces, at most MAX_BATCH_SIZE
+ * @param probabilities Filled with the mask probability of each face
+ */
+void TFLiteBackend::run(const Mat *faces, int count, float *probabilities){
+
+    for(const auto &interpreter : this->interpreters){
+        std::unique_lock<std::mutex> lock(interpreter->lock, std::try_to_lock);
+        if(lock.owns_lock()){
+            runLocked(interpreter.get(), faces, count, probabilities);
+            return;
+        }
+    }
+
+    Interpreter *interpreter = this->interpreters[this->nextInterpreter++ % this->interpreters.size()].get();
+    std::lock_guard<std::mutex> lock(interpreter->lock);
+    runLocked(interpreter, faces, count, probabilities);
+
+}
+
+#endif /* BIGBROTHER_WITH_TFLITE */
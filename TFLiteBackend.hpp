@@ -0,0 +1,61 @@
+/**
+ * @file TFLiteBackend.hpp
+ * @brief Header file for the TFLiteBackend class, which runs a .tflite export of the mask model on the CPU through the TensorFlow Lite C API and its XNNPACK delegate
+ */
+
+#ifndef TFLiteBackend_hpp
+#define TFLiteBackend_hpp
+
+#ifdef BIGBROTHER_WITH_TFLITE
+
+#include <stdio.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <tensorflow/lite/c/c_api.h>
+#include <tensorflow/lite/delegates/xnnpack/xnnpack_delegate.h>
+
+#include "MaskBackend.hpp"
+
+using namespace std;
+
+class TFLiteBackend : public MaskBackend
+{
+
+private:
+    // an interpreter is not thread safe, so each one is used by a single call at a time
+    struct Interpreter {
+        std::mutex lock;
+        TfLiteDelegate *delegate;
+        TfLiteInterpreter *interpreter;
+        // batch size the input is currently resized to
+        int batchSize;
+    };
+
+    TfLiteModel *model;
+    vector<std::unique_ptr<Interpreter>> interpreters;
+    // where to queue once every interpreter is busy
+    std::atomic<unsigned> nextInterpreter;
+
+    // frees the interpreters, delegates and model, also used when the constructor fails part way
+    void release();
+    // runs count faces on an interpreter that is already locked
+    void runLocked(Interpreter *interpreter, const Mat *faces, int count, float *probabilities);
+
+public:
+    // constructor, loads the model and warms up every interpreter
+    TFLiteBackend(string location, SessionConfig config);
+    // destructor
+    ~TFLiteBackend();
+
+    string getName();
+    void run(const Mat *faces, int count, float *probabilities);
+
+};
+
+#endif /* BIGBROTHER_WITH_TFLITE */
+
+#endif /* TFLiteBackend_hpp */
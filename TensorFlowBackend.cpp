@@ -0,0 +1,201 @@
+/**
+ * @file TensorFlowBackend.cpp
+ * @brief Comprises the TensorFlowBackend class. Faces are written straight into pooled input tensors and each call goes to the least busy of the model's sessions
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "TensorFlowBackend.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Loads the model and runs one inference on a blank face through every session so graph optimization is paid before it serves real faces
+ *
+ * The input and output come from the serving signature, so a retrained model with different layer names loads without a rebuild.
+ * Frozen graphs open the extra sessions over the one imported graph. A SavedModel restores its variables into a single session, so each extra session is a separate load
+ *
+ * @param location Path of the SavedModel folder or frozen graph
+ * @param config Number of sessions and threads per session
+ */
+TensorFlowBackend::TensorFlowBackend(string location, SessionConfig config) : MaskBackend(location, config){
+
+    bool frozen = isFrozenGraph(location);
+    auto type = frozen ? cppflow::model::FROZEN_GRAPH : cppflow::model::SAVED_MODEL;
+
+    cppflow::session_options options;
+    options.intra_op_threads = config.intraOpThreads;
+    options.inter_op_threads = config.interOpThreads;
+
+    auto first = std::make_shared<cppflow::model>(location, type, options);
+
+    const cppflow::signature &signature = first->get_signature();
+    if(signature.inputs.size() != 1 || signature.outputs.size() != 1){
+        throw std::runtime_error(location + " must have one input and one output in its serving signature");
+    }
+
+    const cppflow::signature_tensor &input = signature.inputs[0];
+    if(input.shape.size() != 4 || input.shape[3] != 3
+       || (input.shape[1] != -1 && input.shape[1] != IMG_SIZE) || (input.shape[2] != -1 && input.shape[2] != IMG_SIZE)){
+        throw std::runtime_error(location + " does not take batches of " + std::to_string(IMG_SIZE) + "x" + std::to_string(IMG_SIZE) + " colour faces");
+    }
+
+    this->inputName = input.name;
+    this->outputName = signature.outputs[0].name;
+    this->inputType = input.dtype;
+
+    for(int i = 0; i < std::max(1, config.sessions); i++){
+        auto session = std::make_unique<Session>();
+        if(i == 0){
+            session->model = first;
+        }else if(frozen){
+            session->model = std::make_shared<cppflow::model>(first->new_session(options));
+        }else{
+            session->model = std::make_shared<cppflow::model>(location, type, options);
+        }
+        session->input = session->model->get_signature().inputs[0].output;
+        session->output = session->model->get_signature().outputs[0].output;
+        this->sessions.push_back(std::move(session));
+    }
+
+    // warm up with a blank 150x150 face in whichever type the model takes
+    cppflow::tensor blankFace;
+    if(this->inputType == TF_UINT8){
+        std::vector<uint8_t> blank(IMG_SIZE * IMG_SIZE * 3, 0);
+        blankFace = cppflow::tensor(blank, {1, IMG_SIZE, IMG_SIZE, 3});
+    }else{
+        std::vector<float> blank(IMG_SIZE * IMG_SIZE * 3, 0.f);
+        blankFace = cppflow::tensor(blank, {1, IMG_SIZE, IMG_SIZE, 3});
+    }
+    for(const auto &session : this->sessions){
+        session->model->run({session->input}, {blankFace}, {session->output});
+    }
+
+}
+
+/** @brief destroys TensorFlowBackend.
+ *
+ *  this just destroys the TensorFlowBackend
+ *
+ */
+TensorFlowBackend::~TensorFlowBackend(){
+
+}
+
+/**
+ * @brief Frozen graphs are told apart from SavedModel folders by their extension
+ *
+ * @param location Path of the model
+ * @return True if the model should be loaded as a frozen graph
+ */
+bool TensorFlowBackend::isFrozenGraph(string location){
+
+    return location.size() > 3 && location.compare(location.size() - 3, 3, ".pb") == 0;
+}
+
+string TensorFlowBackend::getName(){
+
+    return "tensorflow";
+}
+
+/**
+ * @brief Runs a batch on the session with the fewest calls in flight. With one session the calls simply run concurrently inside it, TF_SessionRun is thread safe
+ *
+ * @param input Batch of faces in the type the model takes
+ * @return Outputs of the model
+ */
+vector<cppflow::tensor> TensorFlowBackend::run(const cppflow::tensor &input){
+
+    Session *chosen = this->sessions[0].get();
+    for(const auto &session : this->sessions){
+        if(session->busy.load(std::memory_order_relaxed) < chosen->busy.load(std::memory_order_relaxed)){
+            chosen = session.get();
+        }
+    }
+
+    chosen->busy++;
+    cppflow::defer done([chosen](){ chosen->busy--; });
+
+    return chosen->model->run({chosen->input}, {input}, {chosen->output});
+}
+
+/**
+ * @brief Runs one batch through the model, the faces are written straight into a pooled input tensor
+ *
+ * @param faces Faces of IMG_SIZE x IMG_SIZE BGR pixels
+ * @param count Number of faces, at most MAX_BATCH_SIZE
+ * @param probabilities Filled with the mask probability of each face
+ */
+void TensorFlowBackend::run(const Mat *faces, int count, float *probabilities){
+
+    bool rawBytes = this->inputType == TF_UINT8;
+    int slotType = rawBytes ? CV_8UC3 : CV_32FC3;
+    size_t faceBytes = (size_t)IMG_SIZE * IMG_SIZE * 3 * (rawBytes ? sizeof(uint8_t) : sizeof(float));
+
+    TensorPool::Lease lease = inputPool.acquire(count, this->inputType);
+
+    for(int i = 0; i < count; i++){
+        // a Mat header over this face's rows of the pooled tensor, so OpenCV writes in place
+        Mat slot(IMG_SIZE, IMG_SIZE, slotType, (uchar*)lease.getData() + i * faceBytes);
+        // the uint8 model casts and scales inside the graph, so its raw bytes go straight in
+        packFace(faces[i], slot, rawBytes ? 1.0 : 1.0 / 255.0, 0.0);
+    }
+
+    auto output = run(lease.getTensor());
+
+    // read the mask class of each face straight out of the output tensor, padding rows are ignored
+    auto result = output[0].view<float>();
+    size_t classes = result.shape().back();
+
+    for(int i = 0; i < count; i++){
+        probabilities[i] = result[i * classes + 1];
+    }
+
+}
+
+/**
+ * @brief Number of pooled input slots created so far, it should stop growing once each batch size has been used
+ */
+long TensorFlowBackend::getInputSlots(){
+
+    return inputPool.getSlotCount();
+}
+
+cppflow::datatype TensorFlowBackend::getInputType(){
+
+    return this->inputType;
+}
+
+string TensorFlowBackend::getInputName(){
+
+    return this->inputName;
+}
+
+string TensorFlowBackend::getOutputName(){
+
+    return this->outputName;
+}
+
+/**
+ * @brief Traces every n-th run and collects per-op timings and memory, every session records into the first one's profiler so the table covers all calls
+ *
+ * @param everyNRuns How often to trace, 0 turns profiling off
+ * @return The profiler collecting the results, or nullptr when turned off
+ */
+std::shared_ptr<cppflow::profiler> TensorFlowBackend::setProfiling(int everyNRuns){
+
+    if(everyNRuns <= 0){
+        for(const auto &session : this->sessions){
+            session->model->disable_profiling();
+        }
+        return nullptr;
+    }
+
+    auto profiler = this->sessions[0]->model->enable_profiling(everyNRuns);
+    for(const auto &session : this->sessions){
+        session->model->set_profiler(profiler);
+    }
+
+    return profiler;
+}
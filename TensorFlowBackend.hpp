@@ -0,0 +1,67 @@
+/**
+ * @file TensorFlowBackend.hpp
+ * @brief Header file for the TensorFlowBackend class, which runs a SavedModel or frozen graph through libtensorflow via cppflow
+ */
+
+#ifndef TensorFlowBackend_hpp
+#define TensorFlowBackend_hpp
+
+#include <stdio.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cppflow/cppflow.h"
+#include "MaskBackend.hpp"
+#include "TensorPool.hpp"
+
+using namespace std;
+
+class TensorFlowBackend : public MaskBackend
+{
+
+private:
+    // one session of the model and the number of calls running on it
+    struct Session {
+        std::shared_ptr<cppflow::model> model;
+        // the signature input and output, resolved against this session's graph
+        TF_Output input;
+        TF_Output output;
+        std::atomic<int> busy{0};
+    };
+
+    // every session, the first one also holds the profiler
+    vector<std::unique_ptr<Session>> sessions;
+    // graph tensors of the serving signature, kept for reporting
+    string inputName;
+    string outputName;
+    // TF_UINT8 for models from tools/uint8_model.py, which normalize inside the graph
+    cppflow::datatype inputType;
+    // reusable input tensors, one set per batch size
+    TensorPool inputPool;
+
+public:
+    // constructor, loads the model and warms up every session
+    TensorFlowBackend(string location, SessionConfig config);
+    // destructor
+    ~TensorFlowBackend();
+
+    static bool isFrozenGraph(string location);
+
+    string getName();
+    void run(const Mat *faces, int count, float *probabilities);
+    // run an already built batch on whichever session has the fewest calls in flight
+    vector<cppflow::tensor> run(const cppflow::tensor &input);
+    long getInputSlots();
+
+    cppflow::datatype getInputType();
+    string getInputName();
+    string getOutputName();
+
+    // per-op profiling shared by every session, 0 turns it off
+    std::shared_ptr<cppflow::profiler> setProfiling(int everyNRuns);
+
+};
+
+#endif /* TensorFlowBackend_hpp */
@@ -0,0 +1,151 @@
+/**
+ * @file TensorPool.cpp
+ * @brief Comprises the TensorPool class. Input tensors are created once per batch size and type, refilled in place for every call and recycled as soon as the session run returns
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "TensorPool.hpp"
+
+#include <stdlib.h>
+#include <stdexcept>
+
+// TensorFlow only uses caller memory without copying it when it is aligned for its widest vector loads
+static const size_t TENSOR_ALIGNMENT = 64;
+
+/**
+ * @brief Constructor for TensorPool, batch sizes are the powers of two up to MAX_BATCH_SIZE
+ */
+TensorPool::TensorPool() : slotsCreated(0){
+
+    for(int size = 1; size < MAX_BATCH_SIZE; size *= 2){
+        batchSizes.push_back(size);
+    }
+    batchSizes.push_back(MAX_BATCH_SIZE);
+
+    // the slot list itself should not grow during steady state either
+    slots.reserve(batchSizes.size() * 4);
+}
+
+/** @brief destroys TensorPool.
+ *
+ *  releases the tensors before the buffers they point at
+ *
+ */
+TensorPool::~TensorPool(){
+
+    for(auto &slot : slots){
+        slot->tensor = cppflow::tensor();
+        free(slot->buffer);
+    }
+}
+
+/**
+ * @brief Allocates an aligned buffer and wraps it in a TF_Tensor that never frees it, the pool owns the memory
+ *
+ * @param batchSize Number of faces the tensor holds
+ * @param type Element type the model takes
+ * @return The new slot, marked as in use
+ */
+TensorPool::Slot *TensorPool::createSlot(int batchSize, cppflow::datatype type){
+
+    int64_t dims[4] = {batchSize, IMG_SIZE, IMG_SIZE, 3};
+    size_t bytes = (size_t)batchSize * IMG_SIZE * IMG_SIZE * 3 * TF_DataTypeSize(type);
+    size_t alignedBytes = (bytes + TENSOR_ALIGNMENT - 1) / TENSOR_ALIGNMENT * TENSOR_ALIGNMENT;
+
+    void *buffer = aligned_alloc(TENSOR_ALIGNMENT, alignedBytes);
+    if(!buffer){
+        throw std::bad_alloc();
+    }
+
+    auto noDeallocate = [](void*, size_t, void*){};
+    TF_Tensor *tensor = TF_NewTensor(type, dims, 4, buffer, bytes, noDeallocate, nullptr);
+    if(!tensor){
+        free(buffer);
+        throw std::runtime_error("Unable to create a pooled input tensor");
+    }
+
+    std::unique_ptr<Slot> slot(new Slot{batchSize, type, buffer, cppflow::tensor(tensor), true});
+    slots.push_back(std::move(slot));
+
+    slotsCreated++;
+
+    return slots.back().get();
+}
+
+/**
+ * @brief Takes the smallest free tensor that fits, creating one the first time a batch size and type is seen
+ *
+ * Padding rows at the end of the tensor keep whatever the last call left there, callers ignore their outputs
+ *
+ * @param faces Number of faces to fit, at most getMaxBatchSize
+ * @param type Element type the model takes
+ * @return Lease on the tensor, it goes back to the pool when the lease is destroyed
+ */
+TensorPool::Lease TensorPool::acquire(int faces, cppflow::datatype type){
+
+    int batchSize = batchSizes.back();
+    for(int size : batchSizes){
+        if(size >= faces){
+            batchSize = size;
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(poolLock);
+
+    for(auto &slot : slots){
+        if(!slot->inUse && slot->batchSize == batchSize && slot->type == type){
+            slot->inUse = true;
+            return Lease(this, slot.get());
+        }
+    }
+
+    return Lease(this, createSlot(batchSize, type));
+}
+
+/**
+ * @brief Marks a slot as free again
+ */
+void TensorPool::release(Slot *slot){
+
+    std::lock_guard<std::mutex> lock(poolLock);
+    slot->inUse = false;
+}
+
+int TensorPool::getMaxBatchSize(){
+    return batchSizes.back();
+}
+
+long TensorPool::getSlotCount(){
+    return slotsCreated;
+}
+
+TensorPool::Lease::Lease(TensorPool *pool, Slot *slot) : pool(pool), slot(slot){
+
+}
+
+TensorPool::Lease::Lease(Lease &&other) : pool(other.pool), slot(other.slot){
+    other.slot = nullptr;
+}
+
+TensorPool::Lease::~Lease(){
+    if(slot){
+        pool->release(slot);
+    }
+}
+
+/**
+ * @return The aligned buffer behind the tensor, fill it before running the model
+ */
+void *TensorPool::Lease::getData(){
+    return slot->buffer;
+}
+
+const cppflow::tensor &TensorPool::Lease::getTensor(){
+    return slot->tensor;
+}
+
+int TensorPool::Lease::getBatchSize(){
+    return slot->batchSize;
+}
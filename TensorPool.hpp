@@ -0,0 +1,73 @@
+/**
+ * @file TensorPool.hpp
+ * @brief Header file for the TensorPool class, which keeps preallocated, aligned input tensors for each batch size so steady state inference does not allocate input tensors
+ */
+
+#ifndef TensorPool_hpp
+#define TensorPool_hpp
+
+#include <stdio.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cppflow/cppflow.h"
+#include "environment.hpp"
+
+using namespace std;
+
+class TensorPool
+{
+
+private:
+    // one reusable input tensor and the aligned buffer behind it
+    struct Slot {
+        int batchSize;
+        cppflow::datatype type;
+        void *buffer;
+        cppflow::tensor tensor;
+        bool inUse;
+    };
+
+    std::mutex poolLock;
+    vector<std::unique_ptr<Slot>> slots;
+    vector<int> batchSizes;
+    std::atomic<long> slotsCreated;
+
+    Slot *createSlot(int batchSize, cppflow::datatype type);
+    void release(Slot *slot);
+
+public:
+    // hands out a slot and puts it back in the pool when it goes out of scope
+    class Lease {
+    private:
+        TensorPool *pool;
+        Slot *slot;
+    public:
+        Lease(TensorPool *pool, Slot *slot);
+        Lease(Lease &&other);
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+        ~Lease();
+
+        void *getData();
+        const cppflow::tensor &getTensor();
+        int getBatchSize();
+    };
+
+    // constructor
+    TensorPool();
+    // destructor
+    ~TensorPool();
+
+    // smallest pooled tensor that fits the faces, capped at MAX_BATCH_SIZE
+    Lease acquire(int faces, cppflow::datatype type);
+    int getMaxBatchSize();
+
+    // number of slots ever created, each one aligned buffer plus its TF_Tensor, flat once every batch size has been seen
+    long getSlotCount();
+
+};
+
+#endif /* TensorPool_hpp */
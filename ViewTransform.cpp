@@ -0,0 +1,102 @@
+/**
+ * @file ViewTransform.cpp
+ * @brief Comprises the ViewTransform class. The analysis works on the camera frame as it arrives, and only the final display image is cropped, scaled and mirrored, so the full frame is never copied for the view
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include "ViewTransform.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief Constructor for ViewTransform
+ *
+ * @param source Size of the camera frame
+ * @param mirror Whether the view is flipped left to right so it feels like a mirror
+ * @param zoom Columns cut away from the source, the rows follow so the aspect ratio is kept
+ * @param output Size of the display image
+ */
+ViewTransform::ViewTransform(Size source, bool mirror, int zoom, Size output){
+
+    this->source = source;
+    this->mirror = mirror;
+    this->output = output;
+
+    // use a crop ratio to ensure the image doesn't scale awkwardly when zooming
+    const float cropRatio = (float)source.height / (float)source.width;
+
+    // compute the height/width of the shown part after cropping
+    const int cropHeight = source.height - (int)((float)zoom * cropRatio);
+    const int cropWidth = source.width - zoom;
+
+    // the crop is centred, so it is the same part of the source mirrored or not
+    this->crop = Rect((source.width - cropWidth) / 2, (source.height - cropHeight) / 2, cropWidth, cropHeight);
+
+    this->scaleX = (double)output.width / cropWidth;
+    this->scaleY = (double)output.height / cropHeight;
+
+}
+
+/** @brief destroys ViewTransform.
+ *
+ *  this just destroys the ViewTransform
+ *
+ */
+ViewTransform::~ViewTransform(){
+
+}
+
+/**
+ * @brief Renders the shown part of the frame, the crop is a view so only the scaled image is written and the mirror flips that smaller image
+ *
+ * @param frame Camera frame, left untouched
+ * @param display Reused between calls when its size does not change
+ */
+void ViewTransform::render(const Mat &frame, Mat &display) const{
+
+    cv::resize(frame(this->crop), display, this->output, 0, 0, INTER_CUBIC);
+
+    if(this->mirror){
+        flip(display, display, 1);
+    }
+
+}
+
+/**
+ * @brief Maps a position in source pixels to display pixels
+ */
+Point ViewTransform::mapPoint(Point2d point) const{
+
+    double x = (point.x - this->crop.x) * this->scaleX;
+    double y = (point.y - this->crop.y) * this->scaleY;
+
+    if(this->mirror){
+        x = this->output.width - 1 - x;
+    }
+
+    return Point(cvRound(x), cvRound(y));
+}
+
+/**
+ * @brief Maps a box in source pixels to display pixels, mirroring swaps its left and right edges
+ */
+Rect ViewTransform::mapRect(Rect area) const{
+
+    Point a = mapPoint(area.tl());
+    Point b = mapPoint(area.br());
+
+    return Rect(Point(std::min(a.x, b.x), std::min(a.y, b.y)), Point(std::max(a.x, b.x), std::max(a.y, b.y)));
+}
+
+Rect ViewTransform::getCrop() const{
+    return this->crop;
+}
+
+Size ViewTransform::getOutput() const{
+    return this->output;
+}
+
+double ViewTransform::getScale() const{
+    return this->scaleX;
+}
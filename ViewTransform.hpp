@@ -0,0 +1,47 @@
+/**
+ * @file ViewTransform.hpp
+ * @brief Header file for the ViewTransform class, which describes how a camera frame is mirrored, zoomed and scaled for display so analysis can run on the untouched frame
+ */
+
+#ifndef ViewTransform_hpp
+#define ViewTransform_hpp
+
+#include <stdio.h>
+
+#include "opencv.hpp"
+
+using namespace cv;
+
+class ViewTransform
+{
+
+private:
+    Size source;
+    bool mirror;
+    // part of the source that is shown, in source pixels
+    Rect crop;
+    Size output;
+    double scaleX;
+    double scaleY;
+
+public:
+    // constructor, zoom is the number of source columns cut away, split evenly between both sides
+    ViewTransform(Size source, bool mirror, int zoom, Size output);
+    // destructor
+    ~ViewTransform();
+
+    // crops, scales and mirrors the source into display in one pass over the shown pixels
+    void render(const Mat &frame, Mat &display) const;
+
+    // where a point or box of the source ends up on the display
+    Point mapPoint(Point2d point) const;
+    Rect mapRect(Rect area) const;
+
+    Rect getCrop() const;
+    Size getOutput() const;
+    // display pixels per source pixel, used to keep text the same size at any zoom
+    double getScale() const;
+
+};
+
+#endif /* ViewTransform_hpp */
@@ -3,6 +3,8 @@
 
 #include "tensor.h"
 #include "model.h"
+#include "profiler.h"
+#include "signature.h"
 #include "raw_ops.h"
 #include "ops.h"
 #include "datatype.h"
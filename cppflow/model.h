@@ -2,6 +2,8 @@
 #define CPPFLOW2_MODEL_H
 
 #include <tensorflow/c/c_api.h>
+#include <cstdlib>
+#include <map>
 #include <string>
 #include <fstream>
 #include <iostream>
@@ -9,20 +11,87 @@
 
 #include "context.h"
 #include "defer.h"
+#include "profiler.h"
+#include "signature.h"
 #include "tensor.h"
 
 namespace cppflow {
 
+    /**
+     * Threading of a session, 0 lets TensorFlow decide. Setting either count gives the session its own
+     * thread pools, otherwise every session in the process shares the pools sized by the first one
+     */
+    struct session_options {
+        int intra_op_threads = 0;
+        int inter_op_threads = 0;
+    };
+
     class model {
     public:
-        explicit model(const std::string& filename);
+        enum TYPE {
+            SAVED_MODEL,
+            FROZEN_GRAPH
+        };
+
+        /**
+         * Loads a model
+         * @param filename A SavedModel folder, or a binary GraphDef whose variables were frozen into constants
+         * @param type Format of filename. Frozen graphs skip the variable restore
+         * @param options Threading of the session
+         */
+        explicit model(const std::string& filename, const TYPE type=TYPE::SAVED_MODEL, const session_options& options=session_options());
+
+        /**
+         * Opens another session over the same graph, so concurrent callers do not have to share one session.
+         * Only for frozen graphs: the variables of a SavedModel live in the session they were restored into.
+         * @param options Threading of the new session
+         * @return A model sharing this graph, with its own session and no profiler
+         */
+        model new_session(const session_options& options=session_options()) const;
 
         std::vector<std::string> get_operations() const;
         std::vector<int64_t> get_operation_shape(const std::string& operation) const;
+        datatype get_operation_dtype(const std::string& operation) const;
+
+        /**
+         * Serving signatures of the model, read from the SavedModel's MetaGraphDef or inferred for a frozen graph
+         * @param name Signature name
+         * @return Inputs and outputs with their types and shapes, already resolved against the graph
+         */
+        const signature& get_signature(const std::string& name="serving_default") const;
+        std::vector<std::string> get_signature_names() const;
 
         std::vector<tensor> operator()(std::vector<std::tuple<std::string, tensor>> inputs, std::vector<std::string> outputs);
+
+        /**
+         * Runs the model on outputs that were resolved beforehand, e.g. from get_signature, skipping the name lookups
+         */
+        std::vector<tensor> run(const std::vector<TF_Output>& inputs, const std::vector<tensor>& values, const std::vector<TF_Output>& outputs);
+
+        /**
+         * Runs the serving_default signature of a model with a single input
+         * @return Its first output
+         */
         tensor operator()(const tensor& input);
 
+        /**
+         * Traces every n-th run with FULL_TRACE and collects per-op step stats
+         * @param every_n_runs How often to trace, 1 traces every run
+         * @return The profiler the results are collected in
+         */
+        std::shared_ptr<profiler> enable_profiling(int every_n_runs);
+        void disable_profiling();
+
+        /**
+         * Collects into an existing profiler, e.g. one shared by several sessions of the same model
+         */
+        void set_profiler(std::shared_ptr<profiler> prof);
+
+        /**
+         * @return The active profiler, or nullptr if profiling is off
+         */
+        std::shared_ptr<profiler> get_profiler() const;
+
         ~model() = default;
         model(const model &model) = default;
         model(model &&model) = default;
@@ -33,32 +102,133 @@ namespace cppflow {
 
         std::shared_ptr<TF_Graph> graph;
         std::shared_ptr<TF_Session> session;
+        std::shared_ptr<profiler> profiling;
+        std::shared_ptr<const std::map<std::string, signature>> signatures;
+        TYPE type;
+
+        static TF_Buffer* read_graph(const std::string& filename);
+        static std::shared_ptr<TF_SessionOptions> make_session_options(const session_options& options);
+        static void delete_session(TF_Session* sess);
     };
 }
 
 
 namespace cppflow {
 
-    inline model::model(const std::string &filename) {
+    inline model::model(const std::string &filename, const TYPE type, const session_options& options) : type(type) {
         this->graph = {TF_NewGraph(), TF_DeleteGraph};
 
         // Create the session.
-        std::unique_ptr<TF_SessionOptions, decltype(&TF_DeleteSessionOptions)> session_options = {TF_NewSessionOptions(), TF_DeleteSessionOptions};
+        auto session_opts = make_session_options(options);
         std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> run_options = {TF_NewBufferFromString("", 0), TF_DeleteBuffer};
         std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> meta_graph = {TF_NewBuffer(), TF_DeleteBuffer};
 
-        auto session_deleter = [](TF_Session* sess) {
-            TF_DeleteSession(sess, context::get_status());
+        if (type == TYPE::SAVED_MODEL) {
+            int tag_len = 1;
+            const char* tag = "serve";
+            this->session = {TF_LoadSessionFromSavedModel(session_opts.get(), run_options.get(), filename.c_str(),
+                                    &tag, tag_len, this->graph.get(), meta_graph.get(), context::get_status()),
+                             delete_session};
+
             status_check(context::get_status());
-        };
 
-        int tag_len = 1;
-        const char* tag = "serve";
-        this->session = {TF_LoadSessionFromSavedModel(session_options.get(), run_options.get(), filename.c_str(),
-                                &tag, tag_len, this->graph.get(), meta_graph.get(), context::get_status()),
-                         session_deleter};
+            this->signatures = std::make_shared<std::map<std::string, signature>>(
+                    parse_signatures(meta_graph->data, meta_graph->length, this->graph.get()));
+        }
+        else if (type == TYPE::FROZEN_GRAPH) {
+            std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> def = {read_graph(filename), TF_DeleteBuffer};
+            std::unique_ptr<TF_ImportGraphDefOptions, decltype(&TF_DeleteImportGraphDefOptions)> graph_opts = {TF_NewImportGraphDefOptions(), TF_DeleteImportGraphDefOptions};
+            TF_GraphImportGraphDef(this->graph.get(), def.get(), graph_opts.get(), context::get_status());
+            status_check(context::get_status());
+
+            this->session = {TF_NewSession(this->graph.get(), session_opts.get(), context::get_status()), delete_session};
+            status_check(context::get_status());
+
+            // Freezing drops the MetaGraphDef, so the signature comes from the graph itself
+            this->signatures = std::make_shared<std::map<std::string, signature>>(
+                    std::map<std::string, signature>{{"serving_default", infer_signature(this->graph.get())}});
+        }
+    }
+
+    inline const signature& model::get_signature(const std::string& name) const {
+        auto found = this->signatures->find(name);
+        if (found == this->signatures->end())
+            throw std::runtime_error("The model has no signature named \"" + name + "\"");
+        return found->second;
+    }
+
+    inline std::vector<std::string> model::get_signature_names() const {
+        std::vector<std::string> result;
+        for (const auto& entry : *this->signatures)
+            result.push_back(entry.first);
+        return result;
+    }
+
+    inline std::shared_ptr<TF_SessionOptions> model::make_session_options(const session_options& options) {
+        std::shared_ptr<TF_SessionOptions> result = {TF_NewSessionOptions(), TF_DeleteSessionOptions};
+
+        // ConfigProto { intra_op_parallelism_threads: 2, inter_op_parallelism_threads: 5, use_per_session_threads: 9 }
+        std::string config;
+        if (options.intra_op_threads > 0)
+            proto_write_varint(config, 2, options.intra_op_threads);
+        if (options.inter_op_threads > 0)
+            proto_write_varint(config, 5, options.inter_op_threads);
+        if (!config.empty())
+            proto_write_varint(config, 9, 1);
+
+        if (!config.empty()) {
+            TF_SetConfig(result.get(), config.data(), config.size(), context::get_status());
+            status_check(context::get_status());
+        }
+
+        return result;
+    }
+
+    inline void model::delete_session(TF_Session* sess) {
+        TF_DeleteSession(sess, context::get_status());
+        status_check(context::get_status());
+    }
+
+    inline model model::new_session(const session_options& options) const {
+        if (this->type != TYPE::FROZEN_GRAPH)
+            throw std::runtime_error("Extra sessions need a frozen graph, SavedModel variables only exist in their own session");
 
+        model result = *this;
+        result.profiling = nullptr;
+
+        auto session_opts = make_session_options(options);
+        result.session = {TF_NewSession(this->graph.get(), session_opts.get(), context::get_status()), delete_session};
         status_check(context::get_status());
+
+        return result;
+    }
+
+    inline TF_Buffer* model::read_graph(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            throw std::runtime_error("Unable to open file: " + filename);
+
+        std::streamsize size = file.tellg();
+        if (size <= 0)
+            throw std::runtime_error("Unable to read file: " + filename);
+
+        // Read straight into the buffer TensorFlow frees, the import copies every constant out of it anyway
+        void* data = std::malloc(size);
+        if (!data)
+            throw std::bad_alloc();
+
+        file.seekg(0, std::ios::beg);
+        if (!file.read(static_cast<char*>(data), size)) {
+            std::free(data);
+            throw std::runtime_error("Unable to read file: " + filename);
+        }
+
+        TF_Buffer* buffer = TF_NewBuffer();
+        buffer->data = data;
+        buffer->length = size;
+        buffer->data_deallocator = [](void* data, size_t) { std::free(data); };
+
+        return buffer;
     }
 
     inline std::vector<std::string> model::get_operations() const {
@@ -115,10 +285,25 @@ namespace cppflow {
         return (idx == -1 ? std::make_tuple(name, 0) : std::make_tuple(name.substr(0, idx), std::stoi(name.substr(idx + 1))));
     }
 
+    inline datatype model::get_operation_dtype(const std::string& operation) const {
+        // Get operation by the name, "name:index" selects an output other than the first
+        const auto[op_name, op_idx] = parse_name(operation);
+        TF_Output out_op;
+        out_op.oper = TF_GraphOperationByName(this->graph.get(), op_name.c_str());
+        out_op.index = op_idx;
+
+        // Operation does not exist
+        if (!out_op.oper)
+            throw std::runtime_error("No operation named \"" + op_name + "\" exists");
+
+        return TF_OperationOutputType(out_op);
+    }
+
     inline std::vector<tensor> model::operator()(std::vector<std::tuple<std::string, tensor>> inputs, std::vector<std::string> outputs) {
 
         std::vector<TF_Output> inp_ops(inputs.size());
-        std::vector<TF_Tensor*> inp_val(inputs.size(), nullptr);
+        std::vector<tensor> inp_val;
+        inp_val.reserve(inputs.size());
 
         for (int i=0; i<inputs.size(); i++) {
 
@@ -131,11 +316,10 @@ namespace cppflow {
                 throw std::runtime_error("No operation named \"" + op_name + "\" exists");
 
             // Values
-            inp_val[i] = std::get<1>(inputs[i]).get_tensor().get();
+            inp_val.push_back(std::get<1>(inputs[i]));
         }
 
         std::vector<TF_Output> out_ops(outputs.size());
-        auto out_val = std::make_unique<TF_Tensor*[]>(outputs.size());
         for (int i=0; i<outputs.size(); i++) {
 
             const auto[op_name, op_idx] = parse_name(outputs[i]);
@@ -147,12 +331,43 @@ namespace cppflow {
 
         }
 
-        TF_SessionRun(this->session.get(), NULL,
-                inp_ops.data(), inp_val.data(), inputs.size(),
-                out_ops.data(), out_val.get(), outputs.size(),
-                NULL, 0,NULL , context::get_status());
+        return run(inp_ops, inp_val, out_ops);
+    }
+
+    inline std::vector<tensor> model::run(const std::vector<TF_Output>& inputs, const std::vector<tensor>& values, const std::vector<TF_Output>& outputs) {
+
+        if (inputs.size() != values.size())
+            throw std::runtime_error("Every input needs exactly one value");
+
+        std::vector<TF_Tensor*> inp_val(values.size(), nullptr);
+        for (int i=0; i<values.size(); i++)
+            inp_val[i] = values[i].get_tensor().get();
+
+        auto out_val = std::make_unique<TF_Tensor*[]>(outputs.size());
+
+        // Only sampled runs pay for tracing, the rest pass no options or metadata
+        auto prof = get_profiler();
+        bool trace = prof && prof->should_trace();
+
+        std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> run_options = {nullptr, TF_DeleteBuffer};
+        std::unique_ptr<TF_Buffer, decltype(&TF_DeleteBuffer)> run_metadata = {nullptr, TF_DeleteBuffer};
+        if (trace) {
+            // RunOptions { trace_level: FULL_TRACE }
+            std::string options;
+            proto_write_varint(options, 1, 3);
+            run_options.reset(TF_NewBufferFromString(options.data(), options.size()));
+            run_metadata.reset(TF_NewBuffer());
+        }
+
+        TF_SessionRun(this->session.get(), run_options.get(),
+                inputs.data(), inp_val.data(), inputs.size(),
+                outputs.data(), out_val.get(), outputs.size(),
+                NULL, 0, run_metadata.get(), context::get_status());
         status_check(context::get_status());
 
+        if (trace)
+            prof->record(run_metadata.get());
+
         std::vector<tensor> result;
         result.reserve(outputs.size());
         for (int i=0; i<outputs.size(); i++) {
@@ -162,8 +377,30 @@ namespace cppflow {
         return result;
     }
 
+    inline std::shared_ptr<profiler> model::enable_profiling(int every_n_runs) {
+        auto prof = std::make_shared<profiler>(every_n_runs);
+        std::atomic_store(&this->profiling, prof);
+        return prof;
+    }
+
+    inline void model::set_profiler(std::shared_ptr<profiler> prof) {
+        std::atomic_store(&this->profiling, prof);
+    }
+
+    inline void model::disable_profiling() {
+        std::atomic_store(&this->profiling, std::shared_ptr<profiler>());
+    }
+
+    inline std::shared_ptr<profiler> model::get_profiler() const {
+        return std::atomic_load(&this->profiling);
+    }
+
     inline tensor model::operator()(const tensor& input) {
-        return (*this)({{"serving_default_input_1", input}}, {"StatefulPartitionedCall"})[0];
+        const auto& sig = get_signature();
+        if (sig.inputs.size() != 1 || sig.outputs.empty())
+            throw std::runtime_error("serving_default needs exactly one input and an output to be called with a single tensor");
+
+        return run({sig.inputs[0].output}, {input}, {sig.outputs[0].output})[0];
     }
 }
 
@@ -165,13 +165,13 @@ class Operation:
 
         # Add single input template
         add_inputs = textwrap.dedent('''
-            TFE_OpAddInput(op.get(), {}.tfe_handle.get(), context::get_status());
+            TFE_OpAddInput(op.get(), {}.get_eager_handle().get(), context::get_status());
             status_check(context::get_status());
         ''').replace('\n', '\n    ')
 
         add_inputs_list = textwrap.dedent('''
             std::vector<TFE_TensorHandle*> {0}_handles; {0}_handles.reserve({0}.size());
-            std::transform({0}.begin(), {0}.end(), std::back_inserter({0}_handles), [](const auto& t) {{ return t.tfe_handle.get();}});
+            std::transform({0}.begin(), {0}.end(), std::back_inserter({0}_handles), [](const auto& t) {{ return t.get_eager_handle().get();}});
             TFE_OpAddInputList(op.get(), {0}_handles.data(), {0}.size(), context::get_status());
             status_check(context::get_status());
         ''').replace('\n', '\n    ')
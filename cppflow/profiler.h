@@ -0,0 +1,272 @@
+#ifndef CPPFLOW2_PROFILER_H
+#define CPPFLOW2_PROFILER_H
+
+#include <tensorflow/c/c_api.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "proto.h"
+
+namespace cppflow {
+
+    /**
+     * @class profiler
+     * @brief Collects per-op wall time and memory from the step stats of traced session runs
+     *
+     * Attach one with model::enable_profiling. Every n-th run is executed with FULL_TRACE and its
+     * RunMetadata is folded into per-op totals; the ops of the latest traced run are kept for a Chrome trace.
+     */
+    class profiler {
+    public:
+        struct op_stats {
+            std::string name;
+            std::string type;
+            int64_t calls = 0;
+            int64_t total_micros = 0;
+            int64_t total_bytes = 0;
+            int64_t peak_bytes = 0;
+        };
+
+        struct trace_event {
+            std::string name;
+            std::string type;
+            std::string device;
+            uint32_t thread = 0;
+            int64_t start_micros = 0;
+            int64_t duration_micros = 0;
+            int64_t bytes = 0;
+        };
+
+        explicit profiler(int every_n_runs);
+
+        /**
+         * Counts a run
+         * @return true if this run should be traced
+         */
+        bool should_trace();
+
+        /**
+         * Adds the step stats of a traced run
+         * @param run_metadata Serialized RunMetadata filled in by TF_SessionRun
+         */
+        void record(const TF_Buffer* run_metadata);
+
+        /**
+         * @return Per-op totals, most expensive first
+         */
+        std::vector<op_stats> ops() const;
+
+        /**
+         * @return Number of runs that were traced
+         */
+        int64_t traced_runs() const;
+
+        /**
+         * @return The per-op totals as a text table, most expensive first
+         */
+        std::string table() const;
+
+        /**
+         * @return The ops of the latest traced run in Chrome trace event format (load it in chrome://tracing)
+         */
+        std::string chrome_trace() const;
+
+    private:
+        int every;
+        std::atomic<int64_t> runs{0};
+
+        mutable std::mutex lock;
+        std::map<std::string, op_stats> stats;
+        std::vector<trace_event> last_trace;
+        int64_t traced = 0;
+
+        static std::string op_type(const std::string& timeline_label);
+        static std::string json_escape(const std::string& text);
+    };
+}
+
+
+/******************************
+ *   IMPLEMENTATION DETAILS   *
+ ******************************/
+
+
+namespace cppflow {
+
+    inline profiler::profiler(int every_n_runs) : every(std::max(1, every_n_runs)) {}
+
+    inline bool profiler::should_trace() {
+        return runs++ % every == 0;
+    }
+
+    // Timeline labels look like "node_name = OpType(input, ...)"
+    inline std::string profiler::op_type(const std::string& timeline_label) {
+        auto start = timeline_label.find(" = ");
+        if (start == std::string::npos)
+            return "";
+        start += 3;
+        auto end = timeline_label.find('(', start);
+        return timeline_label.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    }
+
+    inline std::string profiler::json_escape(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\')
+                escaped.push_back('\\');
+            escaped.push_back(c);
+        }
+        return escaped;
+    }
+
+    inline void profiler::record(const TF_Buffer* run_metadata) {
+        std::vector<trace_event> events;
+
+        // RunMetadata.step_stats(1) -> StepStats.dev_stats(1) -> DeviceStepStats.node_stats(2) -> NodeExecStats
+        proto_reader metadata(run_metadata->data, run_metadata->length);
+        while (metadata.next()) {
+            if (metadata.field() != 1)
+                continue;
+
+            auto step_stats = metadata.message();
+            while (step_stats.next()) {
+                if (step_stats.field() != 1)
+                    continue;
+
+                std::string device;
+                auto dev_stats = step_stats.message();
+                while (dev_stats.next()) {
+                    if (dev_stats.field() == 1) {
+                        device = dev_stats.string();
+                        continue;
+                    }
+                    if (dev_stats.field() != 2)
+                        continue;
+
+                    trace_event event;
+                    event.device = device;
+
+                    auto node = dev_stats.message();
+                    while (node.next()) {
+                        switch (node.field()) {
+                            case 1: event.name = node.string(); break;
+                            case 2: event.start_micros = static_cast<int64_t>(node.varint()); break;
+                            case 5: event.duration_micros = static_cast<int64_t>(node.varint()); break;
+                            case 8: event.type = op_type(node.string()); break;
+                            case 10: event.thread = static_cast<uint32_t>(node.varint()); break;
+                            case 6: {
+                                // AllocatorMemoryUsed: total_bytes(2), peak_bytes(3)
+                                auto memory = node.message();
+                                while (memory.next())
+                                    if (memory.field() == 2)
+                                        event.bytes += static_cast<int64_t>(memory.varint());
+                                break;
+                            }
+                            default: break;
+                        }
+                    }
+                    events.push_back(event);
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> guard(lock);
+        traced++;
+        for (const auto& event : events) {
+            auto& op = stats[event.name];
+            op.name = event.name;
+            if (!event.type.empty())
+                op.type = event.type;
+            op.calls++;
+            op.total_micros += event.duration_micros;
+            op.total_bytes += event.bytes;
+            op.peak_bytes = std::max(op.peak_bytes, event.bytes);
+        }
+        last_trace = std::move(events);
+    }
+
+    inline std::vector<profiler::op_stats> profiler::ops() const {
+        std::vector<op_stats> result;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            for (const auto& entry : stats)
+                result.push_back(entry.second);
+        }
+        std::sort(result.begin(), result.end(), [](const op_stats& a, const op_stats& b) {
+            return a.total_micros > b.total_micros;
+        });
+        return result;
+    }
+
+    inline int64_t profiler::traced_runs() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return traced;
+    }
+
+    inline std::string profiler::table() const {
+        auto sorted = ops();
+
+        int64_t total = 0;
+        for (const auto& op : sorted)
+            total += op.total_micros;
+
+        char line[512];
+        std::snprintf(line, sizeof(line), "%-48s %-20s %8s %10s %7s %12s\n", "op", "type", "avg us", "total ms", "%", "peak bytes");
+        std::string result = line;
+
+        for (const auto& op : sorted) {
+            double share = total > 0 ? 100.0 * op.total_micros / total : 0.0;
+            std::snprintf(line, sizeof(line), "%-48.48s %-20.20s %8.1f %10.2f %6.1f%% %12lld\n",
+                          op.name.c_str(), op.type.c_str(), static_cast<double>(op.total_micros) / op.calls,
+                          op.total_micros / 1000.0, share, static_cast<long long>(op.peak_bytes));
+            result += line;
+        }
+
+        std::snprintf(line, sizeof(line), "%lld traced runs, %.2f ms of op time per run\n",
+                      static_cast<long long>(traced_runs()), traced_runs() > 0 ? total / 1000.0 / traced_runs() : 0.0);
+        return result + line;
+    }
+
+    inline std::string profiler::chrome_trace() const {
+        std::vector<trace_event> events;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            events = last_trace;
+        }
+
+        int64_t origin = events.empty() ? 0 : events.front().start_micros;
+        for (const auto& event : events)
+            origin = std::min(origin, event.start_micros);
+
+        // One trace process per device
+        std::vector<std::string> devices;
+        std::string result = "{\"traceEvents\":[";
+        bool first = true;
+
+        for (const auto& event : events) {
+            auto it = std::find(devices.begin(), devices.end(), event.device);
+            auto pid = static_cast<size_t>(it - devices.begin());
+            if (it == devices.end()) {
+                devices.push_back(event.device);
+                result += std::string(first ? "" : ",") + "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(pid) +
+                          ",\"args\":{\"name\":\"" + json_escape(event.device) + "\"}}";
+                first = false;
+            }
+
+            result += std::string(first ? "" : ",") + "{\"name\":\"" + json_escape(event.type.empty() ? event.name : event.type) +
+                      "\",\"cat\":\"op\",\"ph\":\"X\",\"pid\":" + std::to_string(pid) + ",\"tid\":" + std::to_string(event.thread) +
+                      ",\"ts\":" + std::to_string(event.start_micros - origin) + ",\"dur\":" + std::to_string(event.duration_micros) +
+                      ",\"args\":{\"name\":\"" + json_escape(event.name) + "\",\"bytes\":" + std::to_string(event.bytes) + "}}";
+            first = false;
+        }
+
+        return result + "]}\n";
+    }
+}
+
+#endif //CPPFLOW2_PROFILER_H
@@ -0,0 +1,146 @@
+#ifndef CPPFLOW2_PROTO_H
+#define CPPFLOW2_PROTO_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace cppflow {
+
+    /**
+     * @class proto_reader
+     * @brief A minimal protobuf wire format reader
+     *
+     * The C API hands back protos (RunMetadata, MetaGraphDef, ...) as serialized buffers. This walks their
+     * fields without depending on the protobuf library or generated code.
+     *
+     *      proto_reader r(buffer->data, buffer->length);
+     *      while (r.next())
+     *          if (r.field() == 1) name = r.string();
+     */
+    class proto_reader {
+    public:
+        proto_reader(const void* data, size_t size);
+
+        /**
+         * Advances to the next field
+         * @return false at the end of the message
+         */
+        bool next();
+
+        /**
+         * @return Field number of the current field
+         */
+        uint32_t field() const { return current_field; }
+
+        /**
+         * @return Value of the current field for varint, fixed32 and fixed64 fields
+         */
+        uint64_t varint() const { return value; }
+
+        /**
+         * @return Value of the current length delimited field as a string
+         */
+        std::string string() const { return std::string(payload, payload_size); }
+
+        /**
+         * @return Reader over the current length delimited field, for nested messages
+         */
+        proto_reader message() const { return proto_reader(payload, payload_size); }
+
+    private:
+        const char* pos;
+        const char* end;
+
+        uint32_t current_field = 0;
+        uint64_t value = 0;
+        const char* payload = nullptr;
+        size_t payload_size = 0;
+
+        uint64_t read_varint();
+    };
+
+    /**
+     * Appends a varint field to a serialized message
+     */
+    inline void proto_write_varint(std::string& out, uint32_t field, uint64_t value) {
+        uint64_t key = (static_cast<uint64_t>(field) << 3) | 0;
+        for (uint64_t v : {key, value}) {
+            while (v >= 0x80) {
+                out.push_back(static_cast<char>((v & 0x7f) | 0x80));
+                v >>= 7;
+            }
+            out.push_back(static_cast<char>(v));
+        }
+    }
+}
+
+
+/******************************
+ *   IMPLEMENTATION DETAILS   *
+ ******************************/
+
+
+namespace cppflow {
+
+    inline proto_reader::proto_reader(const void* data, size_t size) :
+        pos(static_cast<const char*>(data)), end(static_cast<const char*>(data) + size) {}
+
+    inline uint64_t proto_reader::read_varint() {
+        uint64_t result = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= end)
+                throw std::runtime_error("Truncated protobuf varint");
+            auto byte = static_cast<uint8_t>(*pos++);
+            result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return result;
+        }
+        throw std::runtime_error("Malformed protobuf varint");
+    }
+
+    inline bool proto_reader::next() {
+        if (pos >= end)
+            return false;
+
+        uint64_t key = read_varint();
+        current_field = static_cast<uint32_t>(key >> 3);
+        value = 0;
+        payload = nullptr;
+        payload_size = 0;
+
+        switch (key & 0x7) {
+            case 0:
+                value = read_varint();
+                break;
+            case 1:
+                if (end - pos < 8)
+                    throw std::runtime_error("Truncated protobuf fixed64");
+                std::memcpy(&value, pos, 8);
+                pos += 8;
+                break;
+            case 2:
+                payload_size = static_cast<size_t>(read_varint());
+                if (static_cast<size_t>(end - pos) < payload_size)
+                    throw std::runtime_error("Truncated protobuf field");
+                payload = pos;
+                pos += payload_size;
+                break;
+            case 5: {
+                if (end - pos < 4)
+                    throw std::runtime_error("Truncated protobuf fixed32");
+                uint32_t v;
+                std::memcpy(&v, pos, 4);
+                value = v;
+                pos += 4;
+                break;
+            }
+            default:
+                throw std::runtime_error("Unsupported protobuf wire type");
+        }
+        return true;
+    }
+}
+
+#endif //CPPFLOW2_PROTO_H
@@ -31,7 +31,7 @@ inline tensor abs(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -56,7 +56,7 @@ inline tensor accumulate_n_v2(const std::vector<tensor>&inputs, const std::vecto
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -85,7 +85,7 @@ inline tensor accumulator_num_accumulated(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -109,11 +109,11 @@ inline tensor accumulator_take_gradient(const tensor& handle, const tensor& num_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_required.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_required.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -137,7 +137,7 @@ inline tensor acos(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -161,7 +161,7 @@ inline tensor acosh(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -185,11 +185,11 @@ inline tensor add(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -213,15 +213,15 @@ inline tensor add_many_sparse_to_tensors_map(const tensor& sparse_indices, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sparse_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -247,7 +247,7 @@ inline tensor add_n(const std::vector<tensor>&inputs) {
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -272,15 +272,15 @@ inline tensor add_sparse_to_tensors_map(const tensor& sparse_indices, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sparse_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -305,11 +305,11 @@ inline tensor add_v2(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -333,19 +333,19 @@ inline tensor adjust_contrast(const tensor& images, const tensor& contrast_facto
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), contrast_factor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contrast_factor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), min_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), min_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -369,11 +369,11 @@ inline tensor adjust_contrastv2(const tensor& images, const tensor& contrast_fac
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), contrast_factor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contrast_factor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -397,11 +397,11 @@ inline tensor adjust_hue(const tensor& images, const tensor& delta) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), delta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), delta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -425,11 +425,11 @@ inline tensor adjust_saturation(const tensor& images, const tensor& scale) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), scale.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), scale.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -453,11 +453,11 @@ inline tensor all(const tensor& input, const tensor& reduction_indices, bool kee
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -482,11 +482,11 @@ inline tensor all_to_all(const tensor& input, const tensor& group_assignment, in
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), group_assignment.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), group_assignment.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -512,7 +512,7 @@ inline tensor angle(const tensor& input, datatype Tout=static_cast<datatype>(1))
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -565,11 +565,11 @@ inline tensor any(const tensor& input, const tensor& reduction_indices, bool kee
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -594,39 +594,39 @@ inline tensor apply_ada_max(const tensor& var, const tensor& m, const tensor& v,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), m.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), m.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), v.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), v.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta1_power.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta1_power.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -650,31 +650,31 @@ inline tensor apply_adadelta(const tensor& var, const tensor& accum, const tenso
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum_update.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum_update.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rho.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rho.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -698,19 +698,19 @@ inline tensor apply_adagrad(const tensor& var, const tensor& accum, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -735,35 +735,35 @@ inline tensor apply_adagrad_d_a(const tensor& var, const tensor& gradient_accumu
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), gradient_accumulator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradient_accumulator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), gradient_squared_accumulator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradient_squared_accumulator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), global_step.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), global_step.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -787,23 +787,23 @@ inline tensor apply_adagrad_v2(const tensor& var, const tensor& accum, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -828,43 +828,43 @@ inline tensor apply_adam(const tensor& var, const tensor& m, const tensor& v, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), m.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), m.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), v.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), v.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta1_power.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta1_power.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta2_power.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta2_power.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -889,31 +889,31 @@ inline tensor apply_add_sign(const tensor& var, const tensor& m, const tensor& l
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), m.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), m.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sign_decay.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sign_decay.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -937,39 +937,39 @@ inline tensor apply_centered_r_m_s_prop(const tensor& var, const tensor& mg, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mg.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mg.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), ms.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ms.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mom.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mom.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rho.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rho.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), momentum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), momentum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -993,35 +993,35 @@ inline tensor apply_ftrl(const tensor& var, const tensor& accum, const tensor& l
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), linear.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), linear.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr_power.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr_power.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1046,39 +1046,39 @@ inline tensor apply_ftrl_v2(const tensor& var, const tensor& accum, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), linear.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), linear.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2_shrinkage.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2_shrinkage.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr_power.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr_power.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1103,15 +1103,15 @@ inline tensor apply_gradient_descent(const tensor& var, const tensor& alpha, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), delta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), delta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1135,23 +1135,23 @@ inline tensor apply_momentum(const tensor& var, const tensor& accum, const tenso
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), momentum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), momentum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1176,31 +1176,31 @@ inline tensor apply_power_sign(const tensor& var, const tensor& m, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), m.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), m.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), logbase.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), logbase.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sign_decay.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sign_decay.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1224,27 +1224,27 @@ inline tensor apply_proximal_adagrad(const tensor& var, const tensor& accum, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1268,23 +1268,23 @@ inline tensor apply_proximal_gradient_descent(const tensor& var, const tensor& a
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), delta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), delta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1308,35 +1308,35 @@ inline tensor apply_r_m_s_prop(const tensor& var, const tensor& ms, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), ms.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ms.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mom.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mom.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rho.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rho.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), momentum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), momentum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1360,11 +1360,11 @@ inline tensor approximate_equal(const tensor& x, const tensor& y, float toleranc
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1388,11 +1388,11 @@ inline tensor arg_max(const tensor& input, const tensor& dimension, datatype Tid
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dimension.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dimension.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1417,11 +1417,11 @@ inline tensor arg_min(const tensor& input, const tensor& dimension, datatype Tid
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dimension.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dimension.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1446,7 +1446,7 @@ inline tensor as_string(const tensor& input, int64_t precision=-1, bool scientif
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1474,7 +1474,7 @@ inline tensor asin(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1498,7 +1498,7 @@ inline tensor asinh(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1522,11 +1522,11 @@ inline tensor assert_cardinality_dataset(const tensor& input_dataset, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), cardinality.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), cardinality.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1558,11 +1558,11 @@ inline tensor assert_next_dataset(const tensor& input_dataset, const tensor& tra
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), transformations.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), transformations.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1594,11 +1594,11 @@ inline tensor assign(const tensor& ref, const tensor& value, bool validate_shape
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1623,11 +1623,11 @@ inline tensor assign_add(const tensor& ref, const tensor& value, bool use_lockin
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1651,11 +1651,11 @@ inline tensor assign_sub(const tensor& ref, const tensor& value, bool use_lockin
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1679,7 +1679,7 @@ inline tensor atan(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1703,11 +1703,11 @@ inline tensor atan2(const tensor& y, const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1731,7 +1731,7 @@ inline tensor atanh(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1755,7 +1755,7 @@ inline tensor audio_spectrogram(const tensor& input, int64_t window_size, int64_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1781,11 +1781,11 @@ inline tensor audio_summary(const tensor& tag, const tensor& input_tensor, float
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1810,15 +1810,15 @@ inline tensor audio_summary_v2(const tensor& tag, const tensor& input_tensor, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sample_rate.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sample_rate.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1842,15 +1842,15 @@ inline tensor auto_shard_dataset(const tensor& input_dataset, const tensor& num_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_workers.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_workers.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1883,7 +1883,7 @@ inline tensor avg_pool(const tensor& value, const std::vector<int64_t>& ksize, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1910,7 +1910,7 @@ inline tensor avg_pool3_d(const tensor& input, const std::vector<int64_t>& ksize
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1937,11 +1937,11 @@ inline tensor avg_pool3_d_grad(const tensor& orig_input_shape, const tensor& gra
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1968,11 +1968,11 @@ inline tensor avg_pool_grad(const tensor& orig_input_shape, const tensor& grad,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -1999,11 +1999,11 @@ inline tensor banded_triangular_solve(const tensor& matrix, const tensor& rhs, b
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2060,7 +2060,7 @@ inline tensor barrier_incomplete_size(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2084,7 +2084,7 @@ inline tensor barrier_ready_size(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2108,7 +2108,7 @@ inline tensor batch_cholesky(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2132,11 +2132,11 @@ inline tensor batch_cholesky_grad(const tensor& l, const tensor& grad) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), l.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2160,11 +2160,11 @@ inline tensor batch_dataset(const tensor& input_dataset, const tensor& batch_siz
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2196,15 +2196,15 @@ inline tensor batch_dataset_v2(const tensor& input_dataset, const tensor& batch_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), drop_remainder.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), drop_remainder.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2237,7 +2237,7 @@ inline tensor batch_f_f_t(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2261,7 +2261,7 @@ inline tensor batch_f_f_t2_d(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2285,7 +2285,7 @@ inline tensor batch_f_f_t3_d(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2309,7 +2309,7 @@ inline tensor batch_i_f_f_t(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2333,7 +2333,7 @@ inline tensor batch_i_f_f_t2_d(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2357,7 +2357,7 @@ inline tensor batch_i_f_f_t3_d(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2381,11 +2381,11 @@ inline tensor batch_mat_mul(const tensor& x, const tensor& y, bool adj_x=false,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2410,11 +2410,11 @@ inline tensor batch_mat_mul_v2(const tensor& x, const tensor& y, bool adj_x=fals
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2439,15 +2439,15 @@ inline tensor batch_matrix_band_part(const tensor& input, const tensor& num_lowe
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_lower.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_lower.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_upper.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_upper.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2471,7 +2471,7 @@ inline tensor batch_matrix_determinant(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2495,7 +2495,7 @@ inline tensor batch_matrix_diag(const tensor& diagonal) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2519,7 +2519,7 @@ inline tensor batch_matrix_diag_part(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2543,7 +2543,7 @@ inline tensor batch_matrix_inverse(const tensor& input, bool adjoint=false) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2567,11 +2567,11 @@ inline tensor batch_matrix_set_diag(const tensor& input, const tensor& diagonal)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2595,11 +2595,11 @@ inline tensor batch_matrix_solve(const tensor& matrix, const tensor& rhs, bool a
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2623,15 +2623,15 @@ inline tensor batch_matrix_solve_ls(const tensor& matrix, const tensor& rhs, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2_regularizer.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2_regularizer.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2655,11 +2655,11 @@ inline tensor batch_matrix_triangular_solve(const tensor& matrix, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2684,23 +2684,23 @@ inline tensor batch_norm_with_global_normalization(const tensor& t, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), t.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), t.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), m.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), m.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), v.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), v.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), gamma.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gamma.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2725,7 +2725,7 @@ inline tensor batch_self_adjoint_eig(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2749,11 +2749,11 @@ inline tensor batch_to_space(const tensor& input, const tensor& crops, int64_t b
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), crops.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), crops.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2778,15 +2778,15 @@ inline tensor batch_to_space_n_d(const tensor& input, const tensor& block_shape,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), block_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), block_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), crops.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), crops.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2811,7 +2811,7 @@ inline tensor bessel_i0(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2835,7 +2835,7 @@ inline tensor bessel_i0e(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2859,7 +2859,7 @@ inline tensor bessel_i1(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2883,7 +2883,7 @@ inline tensor bessel_i1e(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2907,7 +2907,7 @@ inline tensor bessel_j0(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2931,7 +2931,7 @@ inline tensor bessel_j1(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2955,7 +2955,7 @@ inline tensor bessel_k0(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -2979,7 +2979,7 @@ inline tensor bessel_k0e(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3003,7 +3003,7 @@ inline tensor bessel_k1(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3027,7 +3027,7 @@ inline tensor bessel_k1e(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3051,7 +3051,7 @@ inline tensor bessel_y0(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3075,7 +3075,7 @@ inline tensor bessel_y1(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3099,15 +3099,15 @@ inline tensor betainc(const tensor& a, const tensor& b, const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3131,11 +3131,11 @@ inline tensor bias_add(const tensor& value, const tensor& bias, const std::strin
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), bias.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), bias.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3159,7 +3159,7 @@ inline tensor bias_add_grad(const tensor& out_backprop, const std::string& data_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3183,11 +3183,11 @@ inline tensor bias_add_v1(const tensor& value, const tensor& bias) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), bias.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), bias.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3211,15 +3211,15 @@ inline tensor bincount(const tensor& arr, const tensor& size, const tensor& weig
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), arr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), arr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), weights.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), weights.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3243,7 +3243,7 @@ inline tensor bitcast(const tensor& input, datatype type) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3267,11 +3267,11 @@ inline tensor bitwise_and(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3295,11 +3295,11 @@ inline tensor bitwise_or(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3323,11 +3323,11 @@ inline tensor bitwise_xor(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3351,19 +3351,19 @@ inline tensor boosted_trees_aggregate_stats(const tensor& node_ids, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), node_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), node_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), hessians.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), hessians.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), feature.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), feature.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3389,13 +3389,13 @@ inline tensor boosted_trees_bucketize(const std::vector<tensor>&float_values, co
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> float_values_handles; float_values_handles.reserve(float_values.size());
-    std::transform(float_values.begin(), float_values.end(), std::back_inserter(float_values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(float_values.begin(), float_values.end(), std::back_inserter(float_values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), float_values_handles.data(), float_values.size(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> bucket_boundaries_handles; bucket_boundaries_handles.reserve(bucket_boundaries.size());
-    std::transform(bucket_boundaries.begin(), bucket_boundaries.end(), std::back_inserter(bucket_boundaries_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(bucket_boundaries.begin(), bucket_boundaries.end(), std::back_inserter(bucket_boundaries_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), bucket_boundaries_handles.data(), bucket_boundaries.size(), context::get_status());
     status_check(context::get_status());
     
@@ -3420,23 +3420,23 @@ inline tensor boosted_trees_center_bias(const tensor& tree_ensemble_handle, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tree_ensemble_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tree_ensemble_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mean_gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mean_gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mean_hessians.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mean_hessians.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3482,12 +3482,12 @@ inline tensor boosted_trees_example_debug_outputs(const tensor& tree_ensemble_ha
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tree_ensemble_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tree_ensemble_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> bucketized_features_handles; bucketized_features_handles.reserve(bucketized_features.size());
-    std::transform(bucketized_features.begin(), bucketized_features.end(), std::back_inserter(bucketized_features_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(bucketized_features.begin(), bucketized_features.end(), std::back_inserter(bucketized_features_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), bucketized_features_handles.data(), bucketized_features.size(), context::get_status());
     status_check(context::get_status());
     
@@ -3513,7 +3513,7 @@ inline tensor boosted_trees_flush_quantile_summaries(const tensor& quantile_stre
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), quantile_stream_resource_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), quantile_stream_resource_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3538,16 +3538,16 @@ inline tensor boosted_trees_make_quantile_summaries(const std::vector<tensor>&fl
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> float_values_handles; float_values_handles.reserve(float_values.size());
-    std::transform(float_values.begin(), float_values.end(), std::back_inserter(float_values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(float_values.begin(), float_values.end(), std::back_inserter(float_values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), float_values_handles.data(), float_values.size(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), example_weights.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), example_weights.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3571,20 +3571,20 @@ inline tensor boosted_trees_make_stats_summary(const tensor& node_ids, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), node_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), node_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), hessians.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), hessians.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> bucketized_features_list_handles; bucketized_features_list_handles.reserve(bucketized_features_list.size());
-    std::transform(bucketized_features_list.begin(), bucketized_features_list.end(), std::back_inserter(bucketized_features_list_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(bucketized_features_list.begin(), bucketized_features_list.end(), std::back_inserter(bucketized_features_list_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), bucketized_features_list_handles.data(), bucketized_features_list.size(), context::get_status());
     status_check(context::get_status());
     
@@ -3611,12 +3611,12 @@ inline tensor boosted_trees_predict(const tensor& tree_ensemble_handle, const st
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tree_ensemble_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tree_ensemble_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> bucketized_features_handles; bucketized_features_handles.reserve(bucketized_features.size());
-    std::transform(bucketized_features.begin(), bucketized_features.end(), std::back_inserter(bucketized_features_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(bucketized_features.begin(), bucketized_features.end(), std::back_inserter(bucketized_features_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), bucketized_features_handles.data(), bucketized_features.size(), context::get_status());
     status_check(context::get_status());
     
@@ -3642,7 +3642,7 @@ inline tensor boosted_trees_quantile_stream_resource_get_bucket_boundaries(const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), quantile_stream_resource_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), quantile_stream_resource_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3688,11 +3688,11 @@ inline tensor broadcast_args(const tensor& s0, const tensor& s1) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), s0.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), s0.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), s1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), s1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3716,11 +3716,11 @@ inline tensor broadcast_to(const tensor& input, const tensor& shape, datatype Ti
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3744,7 +3744,7 @@ inline tensor bucketize(const tensor& input, const std::vector<float>& boundarie
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3768,11 +3768,11 @@ inline tensor bytes_produced_stats_dataset(const tensor& input_dataset, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3804,7 +3804,7 @@ inline tensor c_s_r_sparse_matrix_to_dense(const tensor& sparse_input, datatype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sparse_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3828,40 +3828,40 @@ inline tensor c_s_v_dataset(const tensor& filenames, const tensor& compression_t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), compression_type.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), compression_type.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), header.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), header.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), field_delim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), field_delim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), use_quote_delim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), use_quote_delim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), na_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), na_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), select_cols.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), select_cols.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> record_defaults_handles; record_defaults_handles.reserve(record_defaults.size());
-    std::transform(record_defaults.begin(), record_defaults.end(), std::back_inserter(record_defaults_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(record_defaults.begin(), record_defaults.end(), std::back_inserter(record_defaults_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), record_defaults_handles.data(), record_defaults.size(), context::get_status());
     status_check(context::get_status());
     
@@ -3894,11 +3894,11 @@ inline tensor cache_dataset(const tensor& input_dataset, const tensor& filename,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filename.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filename.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3930,15 +3930,15 @@ inline tensor cache_dataset_v2(const tensor& input_dataset, const tensor& filena
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filename.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filename.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), cache.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), cache.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3970,7 +3970,7 @@ inline tensor cast(const tensor& x, datatype SrcT, datatype DstT, bool Truncate=
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -3996,7 +3996,7 @@ inline tensor ceil(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4020,7 +4020,7 @@ inline tensor check_numerics(const tensor& input_tensor, const std::string& mess
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4044,7 +4044,7 @@ inline tensor check_numerics_v2(const tensor& input_tensor, const std::string& m
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4068,7 +4068,7 @@ inline tensor cholesky(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4092,11 +4092,11 @@ inline tensor cholesky_grad(const tensor& l, const tensor& grad) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), l.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4121,7 +4121,7 @@ inline tensor choose_fastest_dataset(const std::vector<tensor>&input_datasets, i
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_datasets_handles; input_datasets_handles.reserve(input_datasets.size());
-    std::transform(input_datasets.begin(), input_datasets.end(), std::back_inserter(input_datasets_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input_datasets.begin(), input_datasets.end(), std::back_inserter(input_datasets_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_datasets_handles.data(), input_datasets.size(), context::get_status());
     status_check(context::get_status());
     
@@ -4156,15 +4156,15 @@ inline tensor clip_by_value(const tensor& t, const tensor& clip_value_min, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), t.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), t.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), clip_value_min.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), clip_value_min.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), clip_value_max.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), clip_value_max.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4217,7 +4217,7 @@ inline tensor collective_bcast_send(const tensor& input, int64_t group_size, int
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4249,7 +4249,7 @@ inline tensor collective_gather(const tensor& input, int64_t group_size, int64_t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4281,11 +4281,11 @@ inline tensor collective_permute(const tensor& input, const tensor& source_targe
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), source_target_pairs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), source_target_pairs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4309,7 +4309,7 @@ inline tensor collective_reduce(const tensor& input, int64_t group_size, int64_t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4341,11 +4341,11 @@ inline tensor compare_and_bitpack(const tensor& input, const tensor& threshold)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), threshold.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), threshold.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4369,11 +4369,11 @@ inline tensor complex(const tensor& real, const tensor& imag, datatype Tout=stat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), real.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), real.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), imag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), imag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4397,7 +4397,7 @@ inline tensor complex_abs(const tensor& x, datatype Tout=static_cast<datatype>(1
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4422,7 +4422,7 @@ inline tensor compress_element(const std::vector<tensor>&components, const std::
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> components_handles; components_handles.reserve(components.size());
-    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), components_handles.data(), components.size(), context::get_status());
     status_check(context::get_status());
     
@@ -4447,12 +4447,12 @@ inline tensor concat(const tensor& concat_dim, const std::vector<tensor>&values)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), concat_dim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), concat_dim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> values_handles; values_handles.reserve(values.size());
-    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), values_handles.data(), values.size(), context::get_status());
     status_check(context::get_status());
     
@@ -4477,12 +4477,12 @@ inline tensor concat_offset(const tensor& concat_dim, const std::vector<tensor>&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), concat_dim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), concat_dim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> shape_handles; shape_handles.reserve(shape.size());
-    std::transform(shape.begin(), shape.end(), std::back_inserter(shape_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(shape.begin(), shape.end(), std::back_inserter(shape_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), shape_handles.data(), shape.size(), context::get_status());
     status_check(context::get_status());
     
@@ -4508,12 +4508,12 @@ inline tensor concat_v2(const std::vector<tensor>&values, const tensor& axis, da
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> values_handles; values_handles.reserve(values.size());
-    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), values_handles.data(), values.size(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), axis.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), axis.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4538,11 +4538,11 @@ inline tensor concatenate_dataset(const tensor& input_dataset, const tensor& ano
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), another_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), another_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4627,7 +4627,7 @@ inline tensor conj(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4651,11 +4651,11 @@ inline tensor conjugate_transpose(const tensor& x, const tensor& perm, datatype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), perm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), perm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4704,11 +4704,11 @@ inline tensor conv2_d(const tensor& input, const tensor& filter, const std::vect
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4737,15 +4737,15 @@ inline tensor conv2_d_backprop_filter(const tensor& input, const tensor& filter_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter_sizes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter_sizes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4774,15 +4774,15 @@ inline tensor conv2_d_backprop_input(const tensor& input_sizes, const tensor& fi
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_sizes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_sizes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4811,11 +4811,11 @@ inline tensor conv3_d(const tensor& input, const tensor& filter, const std::vect
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4842,15 +4842,15 @@ inline tensor conv3_d_backprop_filter(const tensor& input, const tensor& filter,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4876,15 +4876,15 @@ inline tensor conv3_d_backprop_filter_v2(const tensor& input, const tensor& filt
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter_sizes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter_sizes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4911,15 +4911,15 @@ inline tensor conv3_d_backprop_input(const tensor& input, const tensor& filter,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4945,15 +4945,15 @@ inline tensor conv3_d_backprop_input_v2(const tensor& input_sizes, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_sizes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_sizes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -4981,7 +4981,7 @@ inline tensor copy(const tensor& input, const std::vector< std::string>& debug_o
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5010,7 +5010,7 @@ inline tensor copy_host(const tensor& input, const std::vector< std::string>& de
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5039,7 +5039,7 @@ inline tensor cos(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5063,7 +5063,7 @@ inline tensor cosh(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5087,7 +5087,7 @@ inline tensor count_up_to(const tensor& ref, int64_t limit) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5111,19 +5111,19 @@ inline tensor crop_and_resize(const tensor& image, const tensor& boxes, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), box_ind.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), box_ind.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), crop_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), crop_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5148,19 +5148,19 @@ inline tensor crop_and_resize_grad_boxes(const tensor& grads, const tensor& imag
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), box_ind.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), box_ind.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5184,19 +5184,19 @@ inline tensor crop_and_resize_grad_image(const tensor& grads, const tensor& boxe
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), box_ind.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), box_ind.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), image_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), image_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5220,11 +5220,11 @@ inline tensor cross(const tensor& a, const tensor& b) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5248,11 +5248,11 @@ inline tensor cross_replica_sum(const tensor& input, const tensor& group_assignm
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), group_assignment.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), group_assignment.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5276,26 +5276,26 @@ inline tensor cudnn_r_n_n_canonical_to_params(const tensor& num_layers, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), num_layers.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_layers.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_units.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_units.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> weights_handles; weights_handles.reserve(weights.size());
-    std::transform(weights.begin(), weights.end(), std::back_inserter(weights_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(weights.begin(), weights.end(), std::back_inserter(weights_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), weights_handles.data(), weights.size(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> biases_handles; biases_handles.reserve(biases.size());
-    std::transform(biases.begin(), biases.end(), std::back_inserter(biases_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(biases.begin(), biases.end(), std::back_inserter(biases_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), biases_handles.data(), biases.size(), context::get_status());
     status_check(context::get_status());
     
@@ -5326,26 +5326,26 @@ inline tensor cudnn_r_n_n_canonical_to_params_v2(const tensor& num_layers, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), num_layers.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_layers.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_units.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_units.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> weights_handles; weights_handles.reserve(weights.size());
-    std::transform(weights.begin(), weights.end(), std::back_inserter(weights_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(weights.begin(), weights.end(), std::back_inserter(weights_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), weights_handles.data(), weights.size(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> biases_handles; biases_handles.reserve(biases.size());
-    std::transform(biases.begin(), biases.end(), std::back_inserter(biases_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(biases.begin(), biases.end(), std::back_inserter(biases_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), biases_handles.data(), biases.size(), context::get_status());
     status_check(context::get_status());
     
@@ -5378,15 +5378,15 @@ inline tensor cudnn_r_n_n_params_size(const tensor& num_layers, const tensor& nu
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), num_layers.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_layers.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_units.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_units.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5417,11 +5417,11 @@ inline tensor cumprod(const tensor& x, const tensor& axis, bool exclusive=false,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), axis.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), axis.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5447,11 +5447,11 @@ inline tensor cumsum(const tensor& x, const tensor& axis, bool exclusive=false,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), axis.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), axis.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5477,11 +5477,11 @@ inline tensor cumulative_logsumexp(const tensor& x, const tensor& axis, bool exc
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), axis.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), axis.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5507,7 +5507,7 @@ inline tensor data_format_dim_map(const tensor& x, const std::string& src_format
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5532,7 +5532,7 @@ inline tensor data_format_vec_permute(const tensor& x, const std::string& src_fo
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5557,31 +5557,31 @@ inline tensor data_service_dataset(const tensor& dataset_id, const tensor& proce
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dataset_id.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dataset_id.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), processing_mode.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), processing_mode.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), address.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), address.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), protocol.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), protocol.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), job_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), job_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_outstanding_requests.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_outstanding_requests.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), iteration_counter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iteration_counter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5614,7 +5614,7 @@ inline tensor dataset_cardinality(const tensor& input_dataset) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5638,7 +5638,7 @@ inline tensor dataset_from_graph(const tensor& graph_def) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), graph_def.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), graph_def.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5662,7 +5662,7 @@ inline tensor dataset_to_graph(const tensor& input_dataset, const std::vector< s
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5692,7 +5692,7 @@ inline tensor dataset_to_graph_v2(const tensor& input_dataset, int64_t external_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5717,7 +5717,7 @@ inline tensor dataset_to_single_element(const tensor& dataset, const std::vector
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5749,7 +5749,7 @@ inline tensor dawsn(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5773,7 +5773,7 @@ inline tensor debug_gradient_identity(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5797,7 +5797,7 @@ inline tensor debug_gradient_ref_identity(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5821,7 +5821,7 @@ inline tensor debug_identity(const tensor& input, const std::vector< std::string
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5852,7 +5852,7 @@ inline tensor debug_identity_v2(const tensor& input, const std::vector< std::str
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5886,7 +5886,7 @@ inline tensor debug_nan_count(const tensor& input, const std::vector< std::strin
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5917,7 +5917,7 @@ inline tensor debug_numeric_summary(const tensor& input, const std::vector< std:
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5951,7 +5951,7 @@ inline tensor debug_numeric_summary_v2(const tensor& input, datatype output_dtyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -5977,11 +5977,11 @@ inline tensor decode_and_crop_jpeg(const tensor& contents, const tensor& crop_wi
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), contents.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contents.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), crop_window.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), crop_window.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6010,7 +6010,7 @@ inline tensor decode_base64(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6034,7 +6034,7 @@ inline tensor decode_bmp(const tensor& contents, int64_t channels=0) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), contents.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contents.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6058,12 +6058,12 @@ inline tensor decode_c_s_v(const tensor& records, const std::vector<tensor>&reco
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), records.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), records.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> record_defaults_handles; record_defaults_handles.reserve(record_defaults.size());
-    std::transform(record_defaults.begin(), record_defaults.end(), std::back_inserter(record_defaults_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(record_defaults.begin(), record_defaults.end(), std::back_inserter(record_defaults_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), record_defaults_handles.data(), record_defaults.size(), context::get_status());
     status_check(context::get_status());
     
@@ -6092,7 +6092,7 @@ inline tensor decode_compressed(const tensor& bytes, const std::string& compress
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6116,7 +6116,7 @@ inline tensor decode_gif(const tensor& contents) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), contents.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contents.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6140,7 +6140,7 @@ inline tensor decode_j_s_o_n_example(const tensor& json_examples) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), json_examples.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), json_examples.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6164,7 +6164,7 @@ inline tensor decode_jpeg(const tensor& contents, int64_t channels=0, int64_t ra
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), contents.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contents.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6193,11 +6193,11 @@ inline tensor decode_padded_raw(const tensor& input_bytes, const tensor& fixed_l
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), fixed_length.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), fixed_length.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6222,7 +6222,7 @@ inline tensor decode_png(const tensor& contents, int64_t channels=0, datatype dt
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), contents.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contents.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6247,7 +6247,7 @@ inline tensor decode_raw(const tensor& bytes, datatype out_type, bool little_end
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6272,7 +6272,7 @@ inline tensor deep_copy(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6296,15 +6296,15 @@ inline tensor dense_bincount(const tensor& input, const tensor& size, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), weights.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), weights.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6329,11 +6329,11 @@ inline tensor dense_to_c_s_r_sparse_matrix(const tensor& dense_input, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dense_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6357,15 +6357,15 @@ inline tensor dense_to_sparse_batch_dataset(const tensor& input_dataset, const t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), row_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), row_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6397,7 +6397,7 @@ inline tensor depth_to_space(const tensor& input, int64_t block_size, const std:
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6422,11 +6422,11 @@ inline tensor depthwise_conv2d_native(const tensor& input, const tensor& filter,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6454,15 +6454,15 @@ inline tensor depthwise_conv2d_native_backprop_filter(const tensor& input, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter_sizes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter_sizes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6490,15 +6490,15 @@ inline tensor depthwise_conv2d_native_backprop_input(const tensor& input_sizes,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_sizes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_sizes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6526,15 +6526,15 @@ inline tensor dequantize(const tensor& input, const tensor& min_range, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), min_range.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), min_range.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_range.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_range.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6561,7 +6561,7 @@ inline tensor destroy_temporary_variable(const tensor& ref, const std::string& v
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6610,7 +6610,7 @@ inline tensor diag(const tensor& diagonal) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6634,7 +6634,7 @@ inline tensor diag_part(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6658,7 +6658,7 @@ inline tensor digamma(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6682,11 +6682,11 @@ inline tensor dilation2_d(const tensor& input, const tensor& filter, const std::
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6712,15 +6712,15 @@ inline tensor dilation2_d_backprop_filter(const tensor& input, const tensor& fil
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6746,15 +6746,15 @@ inline tensor dilation2_d_backprop_input(const tensor& input, const tensor& filt
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6780,12 +6780,12 @@ inline tensor directed_interleave_dataset(const tensor& selector_input_dataset,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), selector_input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), selector_input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> data_input_datasets_handles; data_input_datasets_handles.reserve(data_input_datasets.size());
-    std::transform(data_input_datasets.begin(), data_input_datasets.end(), std::back_inserter(data_input_datasets_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(data_input_datasets.begin(), data_input_datasets.end(), std::back_inserter(data_input_datasets_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), data_input_datasets_handles.data(), data_input_datasets.size(), context::get_status());
     status_check(context::get_status());
     
@@ -6819,11 +6819,11 @@ inline tensor div(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6847,11 +6847,11 @@ inline tensor div_no_nan(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6875,11 +6875,11 @@ inline tensor draw_bounding_boxes(const tensor& images, const tensor& boxes) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6903,15 +6903,15 @@ inline tensor draw_bounding_boxes_v2(const tensor& images, const tensor& boxes,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), colors.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), colors.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -6998,11 +6998,11 @@ inline tensor dynamic_partition(const tensor& data, const tensor& partitions, in
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), partitions.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), partitions.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7027,13 +7027,13 @@ inline tensor dynamic_stitch(const std::vector<tensor>&indices, const std::vecto
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> indices_handles; indices_handles.reserve(indices.size());
-    std::transform(indices.begin(), indices.end(), std::back_inserter(indices_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(indices.begin(), indices.end(), std::back_inserter(indices_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), indices_handles.data(), indices.size(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> data_handles; data_handles.reserve(data.size());
-    std::transform(data.begin(), data.end(), std::back_inserter(data_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(data.begin(), data.end(), std::back_inserter(data_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), data_handles.data(), data.size(), context::get_status());
     status_check(context::get_status());
     
@@ -7059,7 +7059,7 @@ inline tensor eager_py_func(const std::vector<tensor>&input, const std::string&
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_handles; input_handles.reserve(input.size());
-    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_handles.data(), input.size(), context::get_status());
     status_check(context::get_status());
     
@@ -7087,27 +7087,27 @@ inline tensor edit_distance(const tensor& hypothesis_indices, const tensor& hypo
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), hypothesis_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), hypothesis_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), hypothesis_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), hypothesis_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), hypothesis_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), hypothesis_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), truth_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), truth_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), truth_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), truth_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), truth_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), truth_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7132,7 +7132,7 @@ inline tensor einsum(const std::vector<tensor>&inputs, const std::string& equati
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -7158,7 +7158,7 @@ inline tensor elu(const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7182,11 +7182,11 @@ inline tensor elu_grad(const tensor& gradients, const tensor& outputs) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), outputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), outputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7210,7 +7210,7 @@ inline tensor empty(const tensor& shape, datatype dtype, bool init=false) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7235,11 +7235,11 @@ inline tensor empty_tensor_list(const tensor& element_shape, const tensor& max_n
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_num_elements.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_num_elements.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7264,7 +7264,7 @@ inline tensor encode_base64(const tensor& input, bool pad=false) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7288,7 +7288,7 @@ inline tensor encode_jpeg(const tensor& image, const std::string& format="", int
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7320,11 +7320,11 @@ inline tensor encode_jpeg_variable_quality(const tensor& images, const tensor& q
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), quality.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), quality.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7348,7 +7348,7 @@ inline tensor encode_png(const tensor& image, int64_t compression=-1) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7372,12 +7372,12 @@ inline tensor encode_proto(const tensor& sizes, const std::vector<tensor>&values
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sizes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sizes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> values_handles; values_handles.reserve(values.size());
-    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), values_handles.data(), values.size(), context::get_status());
     status_check(context::get_status());
     
@@ -7409,11 +7409,11 @@ inline tensor encode_wav(const tensor& audio, const tensor& sample_rate) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), audio.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), audio.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sample_rate.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sample_rate.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7437,7 +7437,7 @@ inline tensor ensure_shape(const tensor& input, const std::vector<int64_t>& shap
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7464,7 +7464,7 @@ inline tensor enter(const tensor& data, const std::string& frame_name, bool is_c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7490,11 +7490,11 @@ inline tensor equal(const tensor& x, const tensor& y, bool incompatible_shape_er
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7518,7 +7518,7 @@ inline tensor erf(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7542,7 +7542,7 @@ inline tensor erfc(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7566,7 +7566,7 @@ inline tensor erfinv(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7590,11 +7590,11 @@ inline tensor euclidean_norm(const tensor& input, const tensor& reduction_indice
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7619,7 +7619,7 @@ inline tensor exit(const tensor& data) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7643,7 +7643,7 @@ inline tensor exp(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7667,11 +7667,11 @@ inline tensor expand_dims(const tensor& input, const tensor& dim, datatype Tdim=
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7695,11 +7695,11 @@ inline tensor experimental_assert_next_dataset(const tensor& input_dataset, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), transformations.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), transformations.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7731,15 +7731,15 @@ inline tensor experimental_auto_shard_dataset(const tensor& input_dataset, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_workers.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_workers.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7772,11 +7772,11 @@ inline tensor experimental_bytes_produced_stats_dataset(const tensor& input_data
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7808,40 +7808,40 @@ inline tensor experimental_c_s_v_dataset(const tensor& filenames, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), compression_type.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), compression_type.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), header.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), header.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), field_delim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), field_delim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), use_quote_delim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), use_quote_delim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), na_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), na_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), select_cols.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), select_cols.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> record_defaults_handles; record_defaults_handles.reserve(record_defaults.size());
-    std::transform(record_defaults.begin(), record_defaults.end(), std::back_inserter(record_defaults_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(record_defaults.begin(), record_defaults.end(), std::back_inserter(record_defaults_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), record_defaults_handles.data(), record_defaults.size(), context::get_status());
     status_check(context::get_status());
     
@@ -7875,7 +7875,7 @@ inline tensor experimental_choose_fastest_dataset(const std::vector<tensor>&inpu
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_datasets_handles; input_datasets_handles.reserve(input_datasets.size());
-    std::transform(input_datasets.begin(), input_datasets.end(), std::back_inserter(input_datasets_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input_datasets.begin(), input_datasets.end(), std::back_inserter(input_datasets_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_datasets_handles.data(), input_datasets.size(), context::get_status());
     status_check(context::get_status());
     
@@ -7910,7 +7910,7 @@ inline tensor experimental_dataset_cardinality(const tensor& input_dataset) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7934,15 +7934,15 @@ inline tensor experimental_dense_to_sparse_batch_dataset(const tensor& input_dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), row_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), row_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -7974,12 +7974,12 @@ inline tensor experimental_directed_interleave_dataset(const tensor& selector_in
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), selector_input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), selector_input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> data_input_datasets_handles; data_input_datasets_handles.reserve(data_input_datasets.size());
-    std::transform(data_input_datasets.begin(), data_input_datasets.end(), std::back_inserter(data_input_datasets_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(data_input_datasets.begin(), data_input_datasets.end(), std::back_inserter(data_input_datasets_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), data_input_datasets_handles.data(), data_input_datasets.size(), context::get_status());
     status_check(context::get_status());
     
@@ -8013,7 +8013,7 @@ inline tensor experimental_ignore_errors_dataset(const tensor& input_dataset, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8045,7 +8045,7 @@ inline tensor experimental_iterator_get_device(const tensor& resource) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8069,7 +8069,7 @@ inline tensor experimental_l_m_d_b_dataset(const tensor& filenames, const std::v
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8101,11 +8101,11 @@ inline tensor experimental_latency_stats_dataset(const tensor& input_dataset, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8137,7 +8137,7 @@ inline tensor experimental_matching_files_dataset(const tensor& patterns) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), patterns.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), patterns.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8161,11 +8161,11 @@ inline tensor experimental_max_intra_op_parallelism_dataset(const tensor& input_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_intra_op_parallelism.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_intra_op_parallelism.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8197,7 +8197,7 @@ inline tensor experimental_non_serializable_dataset(const tensor& input_dataset,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8229,16 +8229,16 @@ inline tensor experimental_parse_example_dataset(const tensor& input_dataset, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_parallel_calls.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_parallel_calls.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> dense_defaults_handles; dense_defaults_handles.reserve(dense_defaults.size());
-    std::transform(dense_defaults.begin(), dense_defaults.end(), std::back_inserter(dense_defaults_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(dense_defaults.begin(), dense_defaults.end(), std::back_inserter(dense_defaults_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), dense_defaults_handles.data(), dense_defaults.size(), context::get_status());
     status_check(context::get_status());
     
@@ -8292,11 +8292,11 @@ inline tensor experimental_private_thread_pool_dataset(const tensor& input_datas
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_threads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_threads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8328,11 +8328,11 @@ inline tensor experimental_random_dataset(const tensor& seed, const tensor& seed
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8364,11 +8364,11 @@ inline tensor experimental_rebatch_dataset(const tensor& input_dataset, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_replicas.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_replicas.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8401,19 +8401,19 @@ inline tensor experimental_set_stats_aggregator_dataset(const tensor& input_data
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), stats_aggregator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), stats_aggregator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), counter_prefix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), counter_prefix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8445,11 +8445,11 @@ inline tensor experimental_sleep_dataset(const tensor& input_dataset, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sleep_microseconds.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sleep_microseconds.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8481,19 +8481,19 @@ inline tensor experimental_sliding_window_dataset(const tensor& input_dataset, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), window_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), window_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), window_shift.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), window_shift.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), window_stride.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), window_stride.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8525,15 +8525,15 @@ inline tensor experimental_sql_dataset(const tensor& driver_name, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), driver_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), driver_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), data_source_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data_source_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), query.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), query.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8587,7 +8587,7 @@ inline tensor experimental_stats_aggregator_summary(const tensor& iterator) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8611,11 +8611,11 @@ inline tensor experimental_thread_pool_dataset(const tensor& input_dataset, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), thread_pool.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), thread_pool.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8672,7 +8672,7 @@ inline tensor experimental_unbatch_dataset(const tensor& input_dataset, const st
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8704,7 +8704,7 @@ inline tensor experimental_unique_dataset(const tensor& input_dataset, const std
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8736,7 +8736,7 @@ inline tensor expint(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8760,7 +8760,7 @@ inline tensor expm1(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8784,15 +8784,15 @@ inline tensor extract_glimpse(const tensor& input, const tensor& size, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), offsets.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), offsets.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8819,15 +8819,15 @@ inline tensor extract_glimpse_v2(const tensor& input, const tensor& size, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), offsets.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), offsets.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8854,7 +8854,7 @@ inline tensor extract_image_patches(const tensor& images, const std::vector<int6
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8881,7 +8881,7 @@ inline tensor extract_jpeg_shape(const tensor& contents, datatype output_type=st
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), contents.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), contents.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8905,7 +8905,7 @@ inline tensor extract_volume_patches(const tensor& input, const std::vector<int6
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8931,7 +8931,7 @@ inline tensor f_f_t(const tensor& input, datatype Tcomplex=static_cast<datatype>
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8955,7 +8955,7 @@ inline tensor f_f_t2_d(const tensor& input, datatype Tcomplex=static_cast<dataty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -8979,7 +8979,7 @@ inline tensor f_f_t3_d(const tensor& input, datatype Tcomplex=static_cast<dataty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9113,7 +9113,7 @@ inline tensor fake_quant_with_min_max_args(const tensor& inputs, float min=-6.00
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9140,11 +9140,11 @@ inline tensor fake_quant_with_min_max_args_gradient(const tensor& gradients, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9171,15 +9171,15 @@ inline tensor fake_quant_with_min_max_vars(const tensor& inputs, const tensor& m
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), min.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), min.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9204,15 +9204,15 @@ inline tensor fake_quant_with_min_max_vars_per_channel(const tensor& inputs, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), min.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), min.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9237,7 +9237,7 @@ inline tensor fake_queue(const tensor& resource) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9261,11 +9261,11 @@ inline tensor fill(const tensor& dims, const tensor& value, datatype index_type=
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dims.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dims.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9289,7 +9289,7 @@ inline tensor filter_by_last_component_dataset(const tensor& input_dataset, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9321,11 +9321,11 @@ inline tensor fingerprint(const tensor& data, const tensor& method) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), method.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), method.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9349,23 +9349,23 @@ inline tensor fixed_length_record_dataset(const tensor& filenames, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), header_bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), header_bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), record_bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), record_bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), footer_bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), footer_bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9389,27 +9389,27 @@ inline tensor fixed_length_record_dataset_v2(const tensor& filenames, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), header_bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), header_bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), record_bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), record_bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), footer_bytes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), footer_bytes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), compression_type.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), compression_type.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9486,7 +9486,7 @@ inline tensor floor(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9510,11 +9510,11 @@ inline tensor floor_div(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9538,11 +9538,11 @@ inline tensor floor_mod(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9566,19 +9566,19 @@ inline tensor fractional_avg_pool_grad(const tensor& orig_input_input_tensor_sha
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input_input_tensor_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input_input_tensor_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), row_pooling_sequence.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), row_pooling_sequence.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), col_pooling_sequence.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), col_pooling_sequence.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9602,23 +9602,23 @@ inline tensor fractional_max_pool_grad(const tensor& orig_input, const tensor& o
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), orig_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), out_backprop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), out_backprop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), row_pooling_sequence.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), row_pooling_sequence.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), col_pooling_sequence.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), col_pooling_sequence.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9642,7 +9642,7 @@ inline tensor fresnel_cos(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9666,7 +9666,7 @@ inline tensor fresnel_sin(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9690,15 +9690,15 @@ inline tensor fused_pad_conv2_d(const tensor& input, const tensor& paddings, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9724,19 +9724,19 @@ inline tensor fused_resize_and_pad_conv2_d(const tensor& input, const tensor& si
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), filter.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filter.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9763,11 +9763,11 @@ inline tensor gather(const tensor& params, const tensor& indices, datatype Tpara
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), params.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), params.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9793,11 +9793,11 @@ inline tensor gather_nd(const tensor& params, const tensor& indices, datatype Tp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), params.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), params.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9822,15 +9822,15 @@ inline tensor gather_v2(const tensor& params, const tensor& indices, const tenso
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), params.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), params.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), axis.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), axis.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9857,7 +9857,7 @@ inline tensor get_session_handle(const tensor& value) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9881,7 +9881,7 @@ inline tensor get_session_handle_v2(const tensor& value) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9905,7 +9905,7 @@ inline tensor get_session_tensor(const tensor& handle, datatype dtype) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9929,11 +9929,11 @@ inline tensor greater(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9957,11 +9957,11 @@ inline tensor greater_equal(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -9985,7 +9985,7 @@ inline tensor guarantee_const_tensor(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10009,7 +10009,7 @@ inline tensor h_s_v_to_r_g_b(const tensor& images) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10083,15 +10083,15 @@ inline tensor histogram_fixed_width(const tensor& values, const tensor& value_ra
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value_range.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value_range.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), nbins.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), nbins.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10115,11 +10115,11 @@ inline tensor histogram_summary(const tensor& tag, const tensor& values) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10143,7 +10143,7 @@ inline tensor i_f_f_t(const tensor& input, datatype Tcomplex=static_cast<datatyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10167,7 +10167,7 @@ inline tensor i_f_f_t2_d(const tensor& input, datatype Tcomplex=static_cast<data
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10191,7 +10191,7 @@ inline tensor i_f_f_t3_d(const tensor& input, datatype Tcomplex=static_cast<data
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10215,11 +10215,11 @@ inline tensor i_r_f_f_t(const tensor& input, const tensor& fft_length, datatype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), fft_length.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), fft_length.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10244,11 +10244,11 @@ inline tensor i_r_f_f_t2_d(const tensor& input, const tensor& fft_length, dataty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), fft_length.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), fft_length.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10273,11 +10273,11 @@ inline tensor i_r_f_f_t3_d(const tensor& input, const tensor& fft_length, dataty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), fft_length.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), fft_length.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10302,7 +10302,7 @@ inline tensor identity(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10327,7 +10327,7 @@ inline tensor identity_n(const std::vector<tensor>&input) {
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_handles; input_handles.reserve(input.size());
-    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_handles.data(), input.size(), context::get_status());
     status_check(context::get_status());
     
@@ -10396,11 +10396,11 @@ inline tensor igamma(const tensor& a, const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10424,11 +10424,11 @@ inline tensor igamma_grad_a(const tensor& a, const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10452,11 +10452,11 @@ inline tensor igammac(const tensor& a, const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10480,7 +10480,7 @@ inline tensor ignore_errors_dataset(const tensor& input_dataset, const std::vect
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10512,7 +10512,7 @@ inline tensor imag(const tensor& input, datatype Tout=static_cast<datatype>(1))
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10536,15 +10536,15 @@ inline tensor image_projective_transform_v2(const tensor& images, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), transforms.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), transforms.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), output_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), output_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10570,11 +10570,11 @@ inline tensor image_summary(const tensor& tag, const tensor& input_tensor, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10628,11 +10628,11 @@ inline tensor in_top_k(const tensor& predictions, const tensor& targets, int64_t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), predictions.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), predictions.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), targets.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), targets.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10656,15 +10656,15 @@ inline tensor in_top_k_v2(const tensor& predictions, const tensor& targets, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), predictions.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), predictions.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), targets.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), targets.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), k.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), k.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10742,15 +10742,15 @@ inline tensor inplace_add(const tensor& x, const tensor& i, const tensor& v) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), i.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), i.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), v.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), v.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10774,15 +10774,15 @@ inline tensor inplace_sub(const tensor& x, const tensor& i, const tensor& v) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), i.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), i.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), v.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), v.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10806,15 +10806,15 @@ inline tensor inplace_update(const tensor& x, const tensor& i, const tensor& v)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), i.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), i.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), v.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), v.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10838,7 +10838,7 @@ inline tensor inv(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10862,11 +10862,11 @@ inline tensor inv_grad(const tensor& y, const tensor& dy) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dy.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dy.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10890,7 +10890,7 @@ inline tensor invert(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10914,7 +10914,7 @@ inline tensor invert_permutation(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10938,7 +10938,7 @@ inline tensor is_boosted_trees_ensemble_initialized(const tensor& tree_ensemble_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tree_ensemble_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tree_ensemble_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10962,7 +10962,7 @@ inline tensor is_boosted_trees_quantile_stream_resource_initialized(const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), quantile_stream_resource_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), quantile_stream_resource_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -10986,7 +10986,7 @@ inline tensor is_finite(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11010,7 +11010,7 @@ inline tensor is_inf(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11034,7 +11034,7 @@ inline tensor is_nan(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11058,7 +11058,7 @@ inline tensor is_variable_initialized(const tensor& ref, datatype dtype) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11113,7 +11113,7 @@ inline tensor iterator_from_string_handle(const tensor& string_handle, const std
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), string_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), string_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11145,7 +11145,7 @@ inline tensor iterator_from_string_handle_v2(const tensor& string_handle, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), string_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), string_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11177,7 +11177,7 @@ inline tensor iterator_get_device(const tensor& resource) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11201,7 +11201,7 @@ inline tensor iterator_get_next(const tensor& iterator, const std::vector<dataty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11233,7 +11233,7 @@ inline tensor iterator_get_next_as_optional(const tensor& iterator, const std::v
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11265,7 +11265,7 @@ inline tensor iterator_get_next_sync(const tensor& iterator, const std::vector<d
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11297,7 +11297,7 @@ inline tensor iterator_to_string_handle(const tensor& resource_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11352,7 +11352,7 @@ inline tensor l2_loss(const tensor& t) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), t.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), t.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11376,7 +11376,7 @@ inline tensor l_m_d_b_dataset(const tensor& filenames, const std::vector<datatyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11430,7 +11430,7 @@ inline tensor l_r_n(const tensor& input, int64_t depth_radius=5, float bias=1.00
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11457,15 +11457,15 @@ inline tensor l_r_n_grad(const tensor& input_grads, const tensor& input_image, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_grads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_grads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), output_image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), output_image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11492,11 +11492,11 @@ inline tensor latency_stats_dataset(const tensor& input_dataset, const tensor& t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11528,7 +11528,7 @@ inline tensor leaky_relu(const tensor& features, float alpha=2.0000e-01) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11552,11 +11552,11 @@ inline tensor leaky_relu_grad(const tensor& gradients, const tensor& features, f
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11580,11 +11580,11 @@ inline tensor left_shift(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11608,11 +11608,11 @@ inline tensor less(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11636,11 +11636,11 @@ inline tensor less_equal(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11664,7 +11664,7 @@ inline tensor lgamma(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11688,15 +11688,15 @@ inline tensor lin_space(const tensor& start, const tensor& stop, const tensor& n
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), start.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), start.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), stop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), stop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11720,23 +11720,23 @@ inline tensor load_and_remap_matrix(const tensor& ckpt_path, const tensor& old_i
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ckpt_path.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ckpt_path.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), old_input_tensor_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), old_input_tensor_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), row_remapping.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), row_remapping.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), col_remapping.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), col_remapping.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), initializing_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), initializing_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11762,7 +11762,7 @@ inline tensor log(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11786,7 +11786,7 @@ inline tensor log1p(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11810,7 +11810,7 @@ inline tensor log_softmax(const tensor& logits) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), logits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), logits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11834,11 +11834,11 @@ inline tensor logical_and(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11862,7 +11862,7 @@ inline tensor logical_not(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11886,11 +11886,11 @@ inline tensor logical_or(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11914,15 +11914,15 @@ inline tensor lookup_table_find(const tensor& table_handle, const tensor& keys,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), table_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), table_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), keys.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), keys.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), default_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), default_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11947,15 +11947,15 @@ inline tensor lookup_table_find_v2(const tensor& table_handle, const tensor& key
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), table_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), table_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), keys.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), keys.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), default_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), default_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -11980,7 +11980,7 @@ inline tensor lookup_table_size(const tensor& table_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), table_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), table_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12004,7 +12004,7 @@ inline tensor lookup_table_size_v2(const tensor& table_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), table_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), table_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12028,7 +12028,7 @@ inline tensor loop_cond(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12052,11 +12052,11 @@ inline tensor lower_bound(const tensor& sorted_inputs, const tensor& values, dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sorted_inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sorted_inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12105,11 +12105,11 @@ inline tensor map_peek(const tensor& key, const tensor& indices, const std::vect
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), key.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), key.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12162,11 +12162,11 @@ inline tensor map_unstage(const tensor& key, const tensor& indices, const std::v
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), key.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), key.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12194,11 +12194,11 @@ inline tensor mat_mul(const tensor& a, const tensor& b, bool transpose_a=false,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12223,7 +12223,7 @@ inline tensor matching_files(const tensor& pattern) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), pattern.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), pattern.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12247,7 +12247,7 @@ inline tensor matching_files_dataset(const tensor& patterns) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), patterns.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), patterns.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12271,15 +12271,15 @@ inline tensor matrix_band_part(const tensor& input, const tensor& num_lower, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_lower.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_lower.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_upper.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_upper.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12303,7 +12303,7 @@ inline tensor matrix_determinant(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12327,7 +12327,7 @@ inline tensor matrix_diag(const tensor& diagonal) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12351,7 +12351,7 @@ inline tensor matrix_diag_part(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12375,15 +12375,15 @@ inline tensor matrix_diag_part_v2(const tensor& input, const tensor& k, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), k.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), k.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), padding_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), padding_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12407,15 +12407,15 @@ inline tensor matrix_diag_part_v3(const tensor& input, const tensor& k, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), k.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), k.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), padding_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), padding_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12439,23 +12439,23 @@ inline tensor matrix_diag_v2(const tensor& diagonal, const tensor& k, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), k.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), k.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_rows.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_rows.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_cols.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_cols.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), padding_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), padding_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12479,23 +12479,23 @@ inline tensor matrix_diag_v3(const tensor& diagonal, const tensor& k, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), k.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), k.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_rows.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_rows.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_cols.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_cols.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), padding_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), padding_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12519,7 +12519,7 @@ inline tensor matrix_exponential(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12543,7 +12543,7 @@ inline tensor matrix_inverse(const tensor& input, bool adjoint=false) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12567,7 +12567,7 @@ inline tensor matrix_logarithm(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12591,11 +12591,11 @@ inline tensor matrix_set_diag(const tensor& input, const tensor& diagonal) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12619,15 +12619,15 @@ inline tensor matrix_set_diag_v2(const tensor& input, const tensor& diagonal, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), k.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), k.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12651,15 +12651,15 @@ inline tensor matrix_set_diag_v3(const tensor& input, const tensor& diagonal, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), diagonal.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonal.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), k.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), k.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12683,11 +12683,11 @@ inline tensor matrix_solve(const tensor& matrix, const tensor& rhs, bool adjoint
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12711,15 +12711,15 @@ inline tensor matrix_solve_ls(const tensor& matrix, const tensor& rhs, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2_regularizer.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2_regularizer.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12743,7 +12743,7 @@ inline tensor matrix_square_root(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12767,11 +12767,11 @@ inline tensor matrix_triangular_solve(const tensor& matrix, const tensor& rhs, b
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12796,11 +12796,11 @@ inline tensor max(const tensor& input, const tensor& reduction_indices, bool kee
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12825,11 +12825,11 @@ inline tensor max_intra_op_parallelism_dataset(const tensor& input_dataset, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_intra_op_parallelism.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_intra_op_parallelism.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12861,7 +12861,7 @@ inline tensor max_pool(const tensor& input, const std::vector<int64_t>& ksize, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12888,7 +12888,7 @@ inline tensor max_pool3_d(const tensor& input, const std::vector<int64_t>& ksize
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12915,15 +12915,15 @@ inline tensor max_pool3_d_grad(const tensor& orig_input, const tensor& orig_outp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), orig_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12951,15 +12951,15 @@ inline tensor max_pool3_d_grad_grad(const tensor& orig_input, const tensor& orig
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), orig_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -12986,15 +12986,15 @@ inline tensor max_pool_grad(const tensor& orig_input, const tensor& orig_output,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), orig_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13021,15 +13021,15 @@ inline tensor max_pool_grad_grad(const tensor& orig_input, const tensor& orig_ou
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), orig_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13056,23 +13056,23 @@ inline tensor max_pool_grad_grad_v2(const tensor& orig_input, const tensor& orig
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), orig_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), ksize.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ksize.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), strides.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), strides.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13097,15 +13097,15 @@ inline tensor max_pool_grad_grad_with_argmax(const tensor& input, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), argmax.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), argmax.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13133,23 +13133,23 @@ inline tensor max_pool_grad_v2(const tensor& orig_input, const tensor& orig_outp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), orig_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), orig_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), orig_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), ksize.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ksize.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), strides.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), strides.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13174,15 +13174,15 @@ inline tensor max_pool_grad_with_argmax(const tensor& input, const tensor& grad,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), argmax.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), argmax.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13210,15 +13210,15 @@ inline tensor max_pool_v2(const tensor& input, const tensor& ksize, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), ksize.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ksize.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), strides.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), strides.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13243,11 +13243,11 @@ inline tensor maximum(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13271,11 +13271,11 @@ inline tensor mean(const tensor& input, const tensor& reduction_indices, bool ke
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13301,7 +13301,7 @@ inline tensor merge_summary(const std::vector<tensor>&inputs) {
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -13326,11 +13326,11 @@ inline tensor mfcc(const tensor& spectrogram, const tensor& sample_rate, float u
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), spectrogram.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), spectrogram.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sample_rate.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sample_rate.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13357,11 +13357,11 @@ inline tensor min(const tensor& input, const tensor& reduction_indices, bool kee
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13386,11 +13386,11 @@ inline tensor minimum(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13414,11 +13414,11 @@ inline tensor mirror_pad(const tensor& input, const tensor& paddings, const std:
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13443,11 +13443,11 @@ inline tensor mirror_pad_grad(const tensor& input, const tensor& paddings, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13472,11 +13472,11 @@ inline tensor mod(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13500,7 +13500,7 @@ inline tensor model_dataset(const tensor& input_dataset, const std::vector<datat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13534,11 +13534,11 @@ inline tensor mul(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13562,11 +13562,11 @@ inline tensor mul_no_nan(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13626,7 +13626,7 @@ inline tensor multi_device_iterator_from_string_handle(const tensor& string_hand
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), string_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), string_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13658,15 +13658,15 @@ inline tensor multi_device_iterator_get_next_from_shard(const tensor& multi_devi
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), multi_device_iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), multi_device_iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shard_num.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shard_num.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), incarnation_id.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), incarnation_id.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13698,15 +13698,15 @@ inline tensor multi_device_iterator_init(const tensor& dataset, const tensor& mu
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), multi_device_iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), multi_device_iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13730,7 +13730,7 @@ inline tensor multi_device_iterator_to_string_handle(const tensor& multi_device_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), multi_device_iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), multi_device_iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13754,11 +13754,11 @@ inline tensor multinomial(const tensor& logits, const tensor& num_samples, int64
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), logits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), logits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_samples.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_samples.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13784,7 +13784,7 @@ inline tensor mutable_dense_hash_table(const tensor& empty_key, datatype key_dty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), empty_key.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), empty_key.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13818,11 +13818,11 @@ inline tensor mutable_dense_hash_table_v2(const tensor& empty_key, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), empty_key.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), empty_key.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), deleted_key.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), deleted_key.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -13964,7 +13964,7 @@ inline tensor mutex_lock(const tensor& mutex) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), mutex.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mutex.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14010,7 +14010,7 @@ inline tensor nccl_all_reduce(const tensor& input, const std::string& reduction,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14036,7 +14036,7 @@ inline tensor nccl_broadcast(const tensor& input, const std::vector<int64_t>& sh
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14064,7 +14064,7 @@ inline tensor nccl_reduce(const std::vector<tensor>&input, const std::string& re
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_handles; input_handles.reserve(input.size());
-    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_handles.data(), input.size(), context::get_status());
     status_check(context::get_status());
     
@@ -14090,7 +14090,7 @@ inline tensor ndtri(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14114,7 +14114,7 @@ inline tensor neg(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14138,11 +14138,11 @@ inline tensor next_after(const tensor& x1, const tensor& x2) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), x2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14166,7 +14166,7 @@ inline tensor next_iteration(const tensor& data) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14190,7 +14190,7 @@ inline tensor non_deterministic_ints(const tensor& shape, datatype dtype=static_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14215,15 +14215,15 @@ inline tensor non_max_suppression(const tensor& boxes, const tensor& scores, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), scores.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), scores.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_output_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_output_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14247,19 +14247,19 @@ inline tensor non_max_suppression_v2(const tensor& boxes, const tensor& scores,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), scores.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), scores.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_output_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_output_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), iou_threshold.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iou_threshold.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14283,23 +14283,23 @@ inline tensor non_max_suppression_v3(const tensor& boxes, const tensor& scores,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), boxes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), boxes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), scores.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), scores.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_output_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_output_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), iou_threshold.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iou_threshold.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), score_threshold.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), score_threshold.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14323,23 +14323,23 @@ inline tensor non_max_suppression_with_overlaps(const tensor& overlaps, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), overlaps.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), overlaps.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), scores.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), scores.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_output_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_output_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), overlap_threshold.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), overlap_threshold.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), score_threshold.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), score_threshold.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14363,7 +14363,7 @@ inline tensor non_serializable_dataset(const tensor& input_dataset, const std::v
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14395,11 +14395,11 @@ inline tensor not_equal(const tensor& x, const tensor& y, bool incompatible_shap
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14423,11 +14423,11 @@ inline tensor nth_element(const tensor& input, const tensor& n, bool reverse=fal
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), n.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), n.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14451,19 +14451,19 @@ inline tensor one_hot(const tensor& indices, const tensor& depth, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), depth.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), depth.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), on_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), on_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), off_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), off_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14488,7 +14488,7 @@ inline tensor ones_like(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14512,11 +14512,11 @@ inline tensor optimize_dataset(const tensor& input_dataset, const tensor& optimi
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), optimizations.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), optimizations.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14554,7 +14554,7 @@ inline tensor optional_from_value(const std::vector<tensor>&components, const st
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> components_handles; components_handles.reserve(components.size());
-    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), components_handles.data(), components.size(), context::get_status());
     status_check(context::get_status());
     
@@ -14579,7 +14579,7 @@ inline tensor optional_get_value(const tensor& optional, const std::vector<datat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), optional.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), optional.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14611,7 +14611,7 @@ inline tensor optional_has_value(const tensor& optional) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), optional.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), optional.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14681,11 +14681,11 @@ inline tensor ordered_map_peek(const tensor& key, const tensor& indices, const s
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), key.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), key.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14738,11 +14738,11 @@ inline tensor ordered_map_unstage(const tensor& key, const tensor& indices, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), key.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), key.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14827,7 +14827,7 @@ inline tensor pack(const std::vector<tensor>&values, int64_t axis=0) {
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> values_handles; values_handles.reserve(values.size());
-    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), values_handles.data(), values.size(), context::get_status());
     status_check(context::get_status());
     
@@ -14853,11 +14853,11 @@ inline tensor pad(const tensor& input, const tensor& paddings, datatype Tpadding
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14881,15 +14881,15 @@ inline tensor pad_v2(const tensor& input, const tensor& paddings, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), constant_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), constant_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -14913,22 +14913,22 @@ inline tensor padded_batch_dataset(const tensor& input_dataset, const tensor& ba
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> padded_shapes_handles; padded_shapes_handles.reserve(padded_shapes.size());
-    std::transform(padded_shapes.begin(), padded_shapes.end(), std::back_inserter(padded_shapes_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(padded_shapes.begin(), padded_shapes.end(), std::back_inserter(padded_shapes_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), padded_shapes_handles.data(), padded_shapes.size(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> padding_values_handles; padding_values_handles.reserve(padding_values.size());
-    std::transform(padding_values.begin(), padding_values.end(), std::back_inserter(padding_values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(padding_values.begin(), padding_values.end(), std::back_inserter(padding_values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), padding_values_handles.data(), padding_values.size(), context::get_status());
     status_check(context::get_status());
     
@@ -14962,27 +14962,27 @@ inline tensor padded_batch_dataset_v2(const tensor& input_dataset, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> padded_shapes_handles; padded_shapes_handles.reserve(padded_shapes.size());
-    std::transform(padded_shapes.begin(), padded_shapes.end(), std::back_inserter(padded_shapes_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(padded_shapes.begin(), padded_shapes.end(), std::back_inserter(padded_shapes_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), padded_shapes_handles.data(), padded_shapes.size(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> padding_values_handles; padding_values_handles.reserve(padding_values.size());
-    std::transform(padding_values.begin(), padding_values.end(), std::back_inserter(padding_values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(padding_values.begin(), padding_values.end(), std::back_inserter(padding_values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), padding_values_handles.data(), padding_values.size(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), drop_remainder.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), drop_remainder.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15081,7 +15081,7 @@ inline tensor parallel_concat(const std::vector<tensor>&values, const std::vecto
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> values_handles; values_handles.reserve(values.size());
-    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(values.begin(), values.end(), std::back_inserter(values_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), values_handles.data(), values.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15111,13 +15111,13 @@ inline tensor parallel_dynamic_stitch(const std::vector<tensor>&indices, const s
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> indices_handles; indices_handles.reserve(indices.size());
-    std::transform(indices.begin(), indices.end(), std::back_inserter(indices_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(indices.begin(), indices.end(), std::back_inserter(indices_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), indices_handles.data(), indices.size(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> data_handles; data_handles.reserve(data.size());
-    std::transform(data.begin(), data.end(), std::back_inserter(data_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(data.begin(), data.end(), std::back_inserter(data_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), data_handles.data(), data.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15142,23 +15142,23 @@ inline tensor parameterized_truncated_normal(const tensor& shape, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), means.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), means.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), stdevs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), stdevs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), minvals.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), minvals.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), maxvals.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), maxvals.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15184,16 +15184,16 @@ inline tensor parse_example_dataset(const tensor& input_dataset, const tensor& n
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_parallel_calls.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_parallel_calls.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> dense_defaults_handles; dense_defaults_handles.reserve(dense_defaults.size());
-    std::transform(dense_defaults.begin(), dense_defaults.end(), std::back_inserter(dense_defaults_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(dense_defaults.begin(), dense_defaults.end(), std::back_inserter(dense_defaults_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), dense_defaults_handles.data(), dense_defaults.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15254,16 +15254,16 @@ inline tensor parse_example_dataset_v2(const tensor& input_dataset, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_parallel_calls.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_parallel_calls.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> dense_defaults_handles; dense_defaults_handles.reserve(dense_defaults.size());
-    std::transform(dense_defaults.begin(), dense_defaults.end(), std::back_inserter(dense_defaults_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(dense_defaults.begin(), dense_defaults.end(), std::back_inserter(dense_defaults_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), dense_defaults_handles.data(), dense_defaults.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15324,7 +15324,7 @@ inline tensor parse_tensor(const tensor& serialized, datatype out_type) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), serialized.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), serialized.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15398,7 +15398,7 @@ inline tensor placeholder_with_default(const tensor& input, datatype dtype, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15426,11 +15426,11 @@ inline tensor polygamma(const tensor& a, const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15454,7 +15454,7 @@ inline tensor population_count(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15478,11 +15478,11 @@ inline tensor pow(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15506,11 +15506,11 @@ inline tensor prefetch_dataset(const tensor& input_dataset, const tensor& buffer
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15544,7 +15544,7 @@ inline tensor prelinearize(const tensor& input, datatype dtype, const std::vecto
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15574,7 +15574,7 @@ inline tensor prelinearize_tuple(const std::vector<tensor>&inputs, const std::ve
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15608,7 +15608,7 @@ inline tensor prevent_gradient(const tensor& input, const std::string& message="
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15632,12 +15632,12 @@ inline tensor print(const tensor& input, const std::vector<tensor>&data, const s
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> data_handles; data_handles.reserve(data.size());
-    std::transform(data.begin(), data.end(), std::back_inserter(data_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(data.begin(), data.end(), std::back_inserter(data_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), data_handles.data(), data.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15729,11 +15729,11 @@ inline tensor private_thread_pool_dataset(const tensor& input_dataset, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_threads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_threads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15765,11 +15765,11 @@ inline tensor prod(const tensor& input, const tensor& reduction_indices, bool ke
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15795,7 +15795,7 @@ inline tensor py_func(const std::vector<tensor>&input, const std::string& token,
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_handles; input_handles.reserve(input.size());
-    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_handles.data(), input.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15823,7 +15823,7 @@ inline tensor py_func_stateless(const std::vector<tensor>&input, const std::stri
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_handles; input_handles.reserve(input.size());
-    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_handles.data(), input.size(), context::get_status());
     status_check(context::get_status());
     
@@ -15850,7 +15850,7 @@ inline tensor quantize_and_dequantize(const tensor& input, bool signed_input=tru
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15878,15 +15878,15 @@ inline tensor quantize_and_dequantize_v2(const tensor& input, const tensor& inpu
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_min.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_min.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_max.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_max.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15915,19 +15915,19 @@ inline tensor quantize_and_dequantize_v3(const tensor& input, const tensor& inpu
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_min.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_min.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_max.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_max.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_bits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_bits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -15954,39 +15954,39 @@ inline tensor quantized_mat_mul_with_bias_and_dequantize(const tensor& a, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), bias.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), bias.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), min_a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), min_a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), min_b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), min_b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), min_freezed_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), min_freezed_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), max_freezed_output.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_freezed_output.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16016,7 +16016,7 @@ inline tensor queue_dequeue(const tensor& handle, const std::vector<datatype>& c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16041,11 +16041,11 @@ inline tensor queue_dequeue_many(const tensor& handle, const tensor& n, const st
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), n.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), n.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16070,11 +16070,11 @@ inline tensor queue_dequeue_many_v2(const tensor& handle, const tensor& n, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), n.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), n.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16099,11 +16099,11 @@ inline tensor queue_dequeue_up_to(const tensor& handle, const tensor& n, const s
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), n.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), n.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16128,11 +16128,11 @@ inline tensor queue_dequeue_up_to_v2(const tensor& handle, const tensor& n, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), n.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), n.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16157,7 +16157,7 @@ inline tensor queue_dequeue_v2(const tensor& handle, const std::vector<datatype>
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16182,7 +16182,7 @@ inline tensor queue_is_closed(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16206,7 +16206,7 @@ inline tensor queue_is_closed_v2(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16230,7 +16230,7 @@ inline tensor queue_size(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16254,7 +16254,7 @@ inline tensor queue_size_v2(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16278,11 +16278,11 @@ inline tensor r_f_f_t(const tensor& input, const tensor& fft_length, datatype Tr
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), fft_length.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), fft_length.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16307,11 +16307,11 @@ inline tensor r_f_f_t2_d(const tensor& input, const tensor& fft_length, datatype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), fft_length.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), fft_length.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16336,11 +16336,11 @@ inline tensor r_f_f_t3_d(const tensor& input, const tensor& fft_length, datatype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), fft_length.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), fft_length.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16365,7 +16365,7 @@ inline tensor r_g_b_to_h_s_v(const tensor& images) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16389,19 +16389,19 @@ inline tensor ragged_bincount(const tensor& splits, const tensor& values, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), splits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), splits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), weights.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), weights.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16426,20 +16426,20 @@ inline tensor ragged_tensor_to_tensor(const tensor& shape, const tensor& values,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), default_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), default_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> row_partition_tensors_handles; row_partition_tensors_handles.reserve(row_partition_tensors.size());
-    std::transform(row_partition_tensors.begin(), row_partition_tensors.end(), std::back_inserter(row_partition_tensors_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(row_partition_tensors.begin(), row_partition_tensors.end(), std::back_inserter(row_partition_tensors_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), row_partition_tensors_handles.data(), row_partition_tensors.size(), context::get_status());
     status_check(context::get_status());
     
@@ -16472,12 +16472,12 @@ inline tensor ragged_tensor_to_variant(const std::vector<tensor>&rt_nested_split
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> rt_nested_splits_handles; rt_nested_splits_handles.reserve(rt_nested_splits.size());
-    std::transform(rt_nested_splits.begin(), rt_nested_splits.end(), std::back_inserter(rt_nested_splits_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(rt_nested_splits.begin(), rt_nested_splits.end(), std::back_inserter(rt_nested_splits_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), rt_nested_splits_handles.data(), rt_nested_splits.size(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rt_dense_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rt_dense_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16504,11 +16504,11 @@ inline tensor random_crop(const tensor& image, const tensor& size, int64_t seed=
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16533,11 +16533,11 @@ inline tensor random_dataset(const tensor& seed, const tensor& seed2, const std:
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16569,11 +16569,11 @@ inline tensor random_gamma(const tensor& shape, const tensor& alpha, datatype S,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16599,11 +16599,11 @@ inline tensor random_gamma_grad(const tensor& alpha, const tensor& sample) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sample.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sample.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16627,11 +16627,11 @@ inline tensor random_poisson(const tensor& shape, const tensor& rate, datatype S
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rate.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rate.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16658,11 +16658,11 @@ inline tensor random_poisson_v2(const tensor& shape, const tensor& rate, datatyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rate.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rate.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16690,7 +16690,7 @@ inline tensor random_shuffle(const tensor& value, int64_t seed=0, int64_t seed2=
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16785,7 +16785,7 @@ inline tensor random_standard_normal(const tensor& shape, datatype dtype, int64_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16811,7 +16811,7 @@ inline tensor random_uniform(const tensor& shape, datatype dtype, int64_t seed=0
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16837,15 +16837,15 @@ inline tensor random_uniform_int(const tensor& shape, const tensor& minval, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), minval.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), minval.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), maxval.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), maxval.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16871,15 +16871,15 @@ inline tensor range(const tensor& start, const tensor& limit, const tensor& delt
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), start.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), start.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), limit.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), limit.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), delta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), delta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16903,15 +16903,15 @@ inline tensor range_dataset(const tensor& start, const tensor& stop, const tenso
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), start.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), start.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), stop.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), stop.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), step.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), step.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16943,7 +16943,7 @@ inline tensor rank(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16967,7 +16967,7 @@ inline tensor read_file(const tensor& filename) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filename.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filename.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -16991,7 +16991,7 @@ inline tensor read_variable_op(const tensor& resource, datatype dtype) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17015,7 +17015,7 @@ inline tensor reader_num_records_produced(const tensor& reader_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), reader_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reader_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17039,7 +17039,7 @@ inline tensor reader_num_records_produced_v2(const tensor& reader_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), reader_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reader_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17063,7 +17063,7 @@ inline tensor reader_num_work_units_completed(const tensor& reader_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), reader_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reader_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17087,7 +17087,7 @@ inline tensor reader_num_work_units_completed_v2(const tensor& reader_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), reader_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reader_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17111,7 +17111,7 @@ inline tensor reader_serialize_state(const tensor& reader_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), reader_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reader_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17135,7 +17135,7 @@ inline tensor reader_serialize_state_v2(const tensor& reader_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), reader_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reader_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17159,7 +17159,7 @@ inline tensor real(const tensor& input, datatype Tout=static_cast<datatype>(1))
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17183,11 +17183,11 @@ inline tensor real_div(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17211,11 +17211,11 @@ inline tensor rebatch_dataset(const tensor& input_dataset, const tensor& num_rep
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_replicas.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_replicas.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17248,7 +17248,7 @@ inline tensor reciprocal(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17272,11 +17272,11 @@ inline tensor reciprocal_grad(const tensor& y, const tensor& dy) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dy.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dy.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17375,11 +17375,11 @@ inline tensor reduce_join(const tensor& inputs, const tensor& reduction_indices,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17404,7 +17404,7 @@ inline tensor ref_enter(const tensor& data, const std::string& frame_name, bool
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17430,7 +17430,7 @@ inline tensor ref_exit(const tensor& data) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17454,7 +17454,7 @@ inline tensor ref_identity(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17478,7 +17478,7 @@ inline tensor ref_next_iteration(const tensor& data) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17502,12 +17502,12 @@ inline tensor ref_select(const tensor& index, const std::vector<tensor>&inputs)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -17532,11 +17532,11 @@ inline tensor regex_full_match(const tensor& input, const tensor& pattern) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), pattern.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), pattern.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17560,15 +17560,15 @@ inline tensor regex_replace(const tensor& input, const tensor& pattern, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), pattern.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), pattern.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rewrite.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rewrite.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17592,15 +17592,15 @@ inline tensor register_dataset(const tensor& dataset, const tensor& address, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), address.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), address.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), protocol.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), protocol.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17624,7 +17624,7 @@ inline tensor relu(const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17648,7 +17648,7 @@ inline tensor relu6(const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17672,11 +17672,11 @@ inline tensor relu6_grad(const tensor& gradients, const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17700,11 +17700,11 @@ inline tensor relu_grad(const tensor& gradients, const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17728,11 +17728,11 @@ inline tensor repeat_dataset(const tensor& input_dataset, const tensor& count, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), count.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), count.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17764,11 +17764,11 @@ inline tensor reshape(const tensor& input_tensor, const tensor& shape, datatype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17792,11 +17792,11 @@ inline tensor resize_area(const tensor& images, const tensor& size, bool align_c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17820,11 +17820,11 @@ inline tensor resize_bicubic(const tensor& images, const tensor& size, bool alig
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17849,11 +17849,11 @@ inline tensor resize_bicubic_grad(const tensor& grads, const tensor& original_im
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), original_image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), original_image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17878,11 +17878,11 @@ inline tensor resize_bilinear(const tensor& images, const tensor& size, bool ali
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17907,11 +17907,11 @@ inline tensor resize_bilinear_grad(const tensor& grads, const tensor& original_i
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), original_image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), original_image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17936,11 +17936,11 @@ inline tensor resize_nearest_neighbor(const tensor& images, const tensor& size,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17965,11 +17965,11 @@ inline tensor resize_nearest_neighbor_grad(const tensor& grads, const tensor& si
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -17994,7 +17994,7 @@ inline tensor resource_accumulator_num_accumulated(const tensor& handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18018,11 +18018,11 @@ inline tensor resource_accumulator_take_gradient(const tensor& handle, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_required.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_required.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18074,7 +18074,7 @@ inline tensor resource_count_up_to(const tensor& resource, int64_t limit) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18098,11 +18098,11 @@ inline tensor resource_gather(const tensor& resource, const tensor& indices, dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18129,11 +18129,11 @@ inline tensor resource_gather_nd(const tensor& resource, const tensor& indices,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18158,11 +18158,11 @@ inline tensor restore(const tensor& file_pattern, const tensor& input_tensor_nam
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), file_pattern.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), file_pattern.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18187,15 +18187,15 @@ inline tensor restore_slice(const tensor& file_pattern, const tensor& input_tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), file_pattern.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), file_pattern.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape_and_slice.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape_and_slice.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18220,15 +18220,15 @@ inline tensor restore_v2(const tensor& prefix, const tensor& input_tensor_names,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), prefix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), prefix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor_names.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor_names.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape_and_slices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape_and_slices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18277,11 +18277,11 @@ inline tensor reverse(const tensor& input_tensor, const tensor& dims) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dims.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dims.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18305,11 +18305,11 @@ inline tensor reverse_sequence(const tensor& input, const tensor& seq_lengths, i
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seq_lengths.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seq_lengths.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18335,11 +18335,11 @@ inline tensor reverse_v2(const tensor& input_tensor, const tensor& axis, datatyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), axis.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), axis.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18363,11 +18363,11 @@ inline tensor right_shift(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18391,7 +18391,7 @@ inline tensor rint(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18415,15 +18415,15 @@ inline tensor roll(const tensor& input, const tensor& shift, const tensor& axis,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shift.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shift.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), axis.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), axis.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18448,7 +18448,7 @@ inline tensor round(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18472,7 +18472,7 @@ inline tensor rsqrt(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18496,11 +18496,11 @@ inline tensor rsqrt_grad(const tensor& y, const tensor& dy) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dy.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dy.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18524,19 +18524,19 @@ inline tensor sampling_dataset(const tensor& input_dataset, const tensor& rate,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rate.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rate.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18568,11 +18568,11 @@ inline tensor scalar_summary(const tensor& tags, const tensor& values) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tags.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tags.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18596,19 +18596,19 @@ inline tensor scale_and_translate(const tensor& images, const tensor& size, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), images.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), images.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), scale.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), scale.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), translation.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), translation.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18633,19 +18633,19 @@ inline tensor scale_and_translate_grad(const tensor& grads, const tensor& origin
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grads.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grads.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), original_image.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), original_image.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), scale.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), scale.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), translation.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), translation.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18670,15 +18670,15 @@ inline tensor scatter_add(const tensor& ref, const tensor& indices, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18703,15 +18703,15 @@ inline tensor scatter_div(const tensor& ref, const tensor& indices, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18736,15 +18736,15 @@ inline tensor scatter_max(const tensor& ref, const tensor& indices, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18769,15 +18769,15 @@ inline tensor scatter_min(const tensor& ref, const tensor& indices, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18802,15 +18802,15 @@ inline tensor scatter_mul(const tensor& ref, const tensor& indices, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18835,15 +18835,15 @@ inline tensor scatter_nd(const tensor& indices, const tensor& updates, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18867,15 +18867,15 @@ inline tensor scatter_nd_add(const tensor& ref, const tensor& indices, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18900,15 +18900,15 @@ inline tensor scatter_nd_max(const tensor& ref, const tensor& indices, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18933,15 +18933,15 @@ inline tensor scatter_nd_min(const tensor& ref, const tensor& indices, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18966,15 +18966,15 @@ inline tensor scatter_nd_non_aliasing_add(const tensor& input, const tensor& ind
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -18998,15 +18998,15 @@ inline tensor scatter_nd_sub(const tensor& ref, const tensor& indices, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19031,15 +19031,15 @@ inline tensor scatter_nd_update(const tensor& ref, const tensor& indices, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19064,15 +19064,15 @@ inline tensor scatter_sub(const tensor& ref, const tensor& indices, const tensor
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19097,15 +19097,15 @@ inline tensor scatter_update(const tensor& ref, const tensor& indices, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19130,7 +19130,7 @@ inline tensor sdca_fprint(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19154,11 +19154,11 @@ inline tensor segment_max(const tensor& data, const tensor& segment_ids, datatyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19182,11 +19182,11 @@ inline tensor segment_mean(const tensor& data, const tensor& segment_ids, dataty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19210,11 +19210,11 @@ inline tensor segment_min(const tensor& data, const tensor& segment_ids, datatyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19238,11 +19238,11 @@ inline tensor segment_prod(const tensor& data, const tensor& segment_ids, dataty
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19266,11 +19266,11 @@ inline tensor segment_sum(const tensor& data, const tensor& segment_ids, datatyp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19294,15 +19294,15 @@ inline tensor select(const tensor& condition, const tensor& t, const tensor& e)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), condition.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), condition.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), t.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), t.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), e.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), e.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19326,15 +19326,15 @@ inline tensor select_v2(const tensor& condition, const tensor& t, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), condition.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), condition.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), t.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), t.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), e.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), e.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19358,7 +19358,7 @@ inline tensor self_adjoint_eig(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19382,7 +19382,7 @@ inline tensor selu(const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19406,11 +19406,11 @@ inline tensor selu_grad(const tensor& gradients, const tensor& outputs) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), outputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), outputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19434,7 +19434,7 @@ inline tensor serialize_iterator(const tensor& resource_handle, int64_t external
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19458,15 +19458,15 @@ inline tensor serialize_many_sparse(const tensor& sparse_indices, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sparse_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19490,15 +19490,15 @@ inline tensor serialize_sparse(const tensor& sparse_indices, const tensor& spars
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sparse_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19522,7 +19522,7 @@ inline tensor serialize_tensor(const tensor& input_tensor) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19546,15 +19546,15 @@ inline tensor set_size(const tensor& set_indices, const tensor& set_values, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), set_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), set_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), set_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), set_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), set_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), set_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19578,19 +19578,19 @@ inline tensor set_stats_aggregator_dataset(const tensor& input_dataset, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), stats_aggregator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), stats_aggregator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), counter_prefix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), counter_prefix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19622,7 +19622,7 @@ inline tensor shape(const tensor& input, datatype out_type=static_cast<datatype>
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19647,7 +19647,7 @@ inline tensor shape_n(const std::vector<tensor>&input, datatype out_type=static_
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_handles; input_handles.reserve(input.size());
-    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input.begin(), input.end(), std::back_inserter(input_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_handles.data(), input.size(), context::get_status());
     status_check(context::get_status());
     
@@ -19673,15 +19673,15 @@ inline tensor shard_dataset(const tensor& input_dataset, const tensor& num_shard
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_shards.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_shards.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19714,15 +19714,15 @@ inline tensor sharded_filename(const tensor& basename, const tensor& shard, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), basename.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), basename.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shard.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shard.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_shards.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_shards.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19746,11 +19746,11 @@ inline tensor sharded_filespec(const tensor& basename, const tensor& num_shards)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), basename.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), basename.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_shards.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_shards.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19774,23 +19774,23 @@ inline tensor shuffle_and_repeat_dataset(const tensor& input_dataset, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), count.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), count.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19823,27 +19823,27 @@ inline tensor shuffle_and_repeat_dataset_v2(const tensor& input_dataset, const t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), count.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), count.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed_generator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed_generator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19876,19 +19876,19 @@ inline tensor shuffle_dataset(const tensor& input_dataset, const tensor& buffer_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19921,15 +19921,15 @@ inline tensor shuffle_dataset_v2(const tensor& input_dataset, const tensor& buff
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed_generator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed_generator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -19961,23 +19961,23 @@ inline tensor shuffle_dataset_v3(const tensor& input_dataset, const tensor& buff
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed_generator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed_generator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20010,7 +20010,7 @@ inline tensor sigmoid(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20034,11 +20034,11 @@ inline tensor sigmoid_grad(const tensor& y, const tensor& dy) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dy.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dy.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20062,7 +20062,7 @@ inline tensor sign(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20086,7 +20086,7 @@ inline tensor sin(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20110,7 +20110,7 @@ inline tensor sinh(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20134,7 +20134,7 @@ inline tensor size(const tensor& input, datatype out_type=static_cast<datatype>(
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20158,11 +20158,11 @@ inline tensor skip_dataset(const tensor& input_dataset, const tensor& count, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), count.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), count.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20194,11 +20194,11 @@ inline tensor sleep_dataset(const tensor& input_dataset, const tensor& sleep_mic
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sleep_microseconds.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sleep_microseconds.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20230,15 +20230,15 @@ inline tensor slice(const tensor& input, const tensor& begin, const tensor& size
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), begin.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), begin.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20262,19 +20262,19 @@ inline tensor sliding_window_dataset(const tensor& input_dataset, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), window_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), window_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), window_shift.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), window_shift.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), window_stride.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), window_stride.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20306,7 +20306,7 @@ inline tensor snapshot(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20330,11 +20330,11 @@ inline tensor snapshot_dataset(const tensor& input_dataset, const tensor& path,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), path.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), path.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20380,15 +20380,15 @@ inline tensor sobol_sample(const tensor& dim, const tensor& num_results, const t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_results.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_results.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), skip.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), skip.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20412,7 +20412,7 @@ inline tensor softmax(const tensor& logits) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), logits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), logits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20436,7 +20436,7 @@ inline tensor softplus(const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20460,11 +20460,11 @@ inline tensor softplus_grad(const tensor& gradients, const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20488,7 +20488,7 @@ inline tensor softsign(const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20512,11 +20512,11 @@ inline tensor softsign_grad(const tensor& gradients, const tensor& features) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), gradients.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradients.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), features.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), features.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20540,11 +20540,11 @@ inline tensor space_to_batch(const tensor& input, const tensor& paddings, int64_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20569,15 +20569,15 @@ inline tensor space_to_batch_n_d(const tensor& input, const tensor& block_shape,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), block_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), block_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), paddings.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), paddings.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20602,7 +20602,7 @@ inline tensor space_to_depth(const tensor& input, int64_t block_size, const std:
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20627,35 +20627,35 @@ inline tensor sparse_apply_adadelta(const tensor& var, const tensor& accum, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum_update.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum_update.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rho.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rho.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20680,23 +20680,23 @@ inline tensor sparse_apply_adagrad(const tensor& var, const tensor& accum, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20722,39 +20722,39 @@ inline tensor sparse_apply_adagrad_d_a(const tensor& var, const tensor& gradient
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), gradient_accumulator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradient_accumulator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), gradient_squared_accumulator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), gradient_squared_accumulator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), global_step.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), global_step.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20779,27 +20779,27 @@ inline tensor sparse_apply_adagrad_v2(const tensor& var, const tensor& accum, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20825,43 +20825,43 @@ inline tensor sparse_apply_centered_r_m_s_prop(const tensor& var, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mg.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mg.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), ms.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ms.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mom.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mom.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rho.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rho.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), momentum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), momentum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20886,39 +20886,39 @@ inline tensor sparse_apply_ftrl(const tensor& var, const tensor& accum, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), linear.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), linear.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr_power.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr_power.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -20944,43 +20944,43 @@ inline tensor sparse_apply_ftrl_v2(const tensor& var, const tensor& accum, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), linear.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), linear.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2_shrinkage.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2_shrinkage.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr_power.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr_power.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21006,27 +21006,27 @@ inline tensor sparse_apply_momentum(const tensor& var, const tensor& accum, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), momentum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), momentum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21052,31 +21052,31 @@ inline tensor sparse_apply_proximal_adagrad(const tensor& var, const tensor& acc
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), accum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), accum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21101,27 +21101,27 @@ inline tensor sparse_apply_proximal_gradient_descent(const tensor& var, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l1.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l1.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), l2.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), l2.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21146,39 +21146,39 @@ inline tensor sparse_apply_r_m_s_prop(const tensor& var, const tensor& ms, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), var.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), var.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), ms.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ms.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), mom.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), mom.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lr.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lr.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rho.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rho.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), momentum.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), momentum.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), epsilon.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), epsilon.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21203,23 +21203,23 @@ inline tensor sparse_bincount(const tensor& indices, const tensor& values, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dense_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), weights.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), weights.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21272,19 +21272,19 @@ inline tensor sparse_dense_cwise_add(const tensor& sp_indices, const tensor& sp_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sp_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dense.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21308,19 +21308,19 @@ inline tensor sparse_dense_cwise_div(const tensor& sp_indices, const tensor& sp_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sp_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dense.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21344,19 +21344,19 @@ inline tensor sparse_dense_cwise_mul(const tensor& sp_indices, const tensor& sp_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sp_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dense.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21380,11 +21380,11 @@ inline tensor sparse_mat_mul(const tensor& a, const tensor& b, bool transpose_a=
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21413,19 +21413,19 @@ inline tensor sparse_matrix_add(const tensor& a, const tensor& b, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), beta.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), beta.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21449,11 +21449,11 @@ inline tensor sparse_matrix_mat_mul(const tensor& a, const tensor& b, bool trans
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21482,11 +21482,11 @@ inline tensor sparse_matrix_mul(const tensor& a, const tensor& b) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21510,7 +21510,7 @@ inline tensor sparse_matrix_n_n_z(const tensor& sparse_matrix) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sparse_matrix.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_matrix.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21534,7 +21534,7 @@ inline tensor sparse_matrix_ordering_a_m_d(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21558,7 +21558,7 @@ inline tensor sparse_matrix_softmax(const tensor& logits, datatype type) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), logits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), logits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21582,11 +21582,11 @@ inline tensor sparse_matrix_softmax_grad(const tensor& softmax, const tensor& gr
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), softmax.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), softmax.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad_softmax.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad_softmax.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21610,11 +21610,11 @@ inline tensor sparse_matrix_sparse_cholesky(const tensor& input, const tensor& p
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), permutation.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), permutation.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21638,11 +21638,11 @@ inline tensor sparse_matrix_sparse_mat_mul(const tensor& a, const tensor& b, dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21670,7 +21670,7 @@ inline tensor sparse_matrix_transpose(const tensor& input, datatype type, bool c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21695,7 +21695,7 @@ inline tensor sparse_matrix_zeros(const tensor& dense_shape, datatype type) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), dense_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21719,19 +21719,19 @@ inline tensor sparse_reduce_max(const tensor& input_indices, const tensor& input
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_axes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_axes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21755,19 +21755,19 @@ inline tensor sparse_reduce_sum(const tensor& input_indices, const tensor& input
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_axes.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_axes.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21791,15 +21791,15 @@ inline tensor sparse_segment_mean(const tensor& data, const tensor& indices, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21824,19 +21824,19 @@ inline tensor sparse_segment_mean_grad(const tensor& grad, const tensor& indices
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), output_dim0.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), output_dim0.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21861,19 +21861,19 @@ inline tensor sparse_segment_mean_with_num_segments(const tensor& data, const te
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21899,15 +21899,15 @@ inline tensor sparse_segment_sqrt_n(const tensor& data, const tensor& indices, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21932,19 +21932,19 @@ inline tensor sparse_segment_sqrt_n_grad(const tensor& grad, const tensor& indic
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), output_dim0.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), output_dim0.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -21969,19 +21969,19 @@ inline tensor sparse_segment_sqrt_n_with_num_segments(const tensor& data, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22007,15 +22007,15 @@ inline tensor sparse_segment_sum(const tensor& data, const tensor& indices, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22040,19 +22040,19 @@ inline tensor sparse_segment_sum_with_num_segments(const tensor& data, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22078,19 +22078,19 @@ inline tensor sparse_slice_grad(const tensor& backprop_val_grad, const tensor& i
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), backprop_val_grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), backprop_val_grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_start.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_start.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), output_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), output_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22114,15 +22114,15 @@ inline tensor sparse_softmax(const tensor& sp_indices, const tensor& sp_values,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sp_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sp_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sp_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22146,19 +22146,19 @@ inline tensor sparse_tensor_dense_add(const tensor& a_indices, const tensor& a_v
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), a_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), a_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22182,19 +22182,19 @@ inline tensor sparse_tensor_dense_mat_mul(const tensor& a_indices, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), a_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), a_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), a_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), a_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22220,15 +22220,15 @@ inline tensor sparse_tensor_slice_dataset(const tensor& indices, const tensor& v
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dense_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22252,15 +22252,15 @@ inline tensor sparse_tensor_to_c_s_r_sparse_matrix(const tensor& indices, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dense_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dense_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22284,19 +22284,19 @@ inline tensor sparse_to_dense(const tensor& sparse_indices, const tensor& output
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sparse_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), output_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), output_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sparse_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sparse_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), default_value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), default_value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22321,7 +22321,7 @@ inline tensor spence(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22345,11 +22345,11 @@ inline tensor split(const tensor& split_dim, const tensor& value, int64_t num_sp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), split_dim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), split_dim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22373,15 +22373,15 @@ inline tensor split_v(const tensor& value, const tensor& size_splits, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size_splits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size_splits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), split_dim.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), split_dim.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22406,15 +22406,15 @@ inline tensor sql_dataset(const tensor& driver_name, const tensor& data_source_n
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), driver_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), driver_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), data_source_name.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data_source_name.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), query.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), query.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22446,7 +22446,7 @@ inline tensor sqrt(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22470,11 +22470,11 @@ inline tensor sqrt_grad(const tensor& y, const tensor& dy) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dy.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dy.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22498,7 +22498,7 @@ inline tensor square(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22522,11 +22522,11 @@ inline tensor squared_difference(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22550,7 +22550,7 @@ inline tensor squeeze(const tensor& input, const std::vector<int64_t>& squeeze_d
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22596,7 +22596,7 @@ inline tensor stack_pop(const tensor& handle, datatype elem_type) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22620,7 +22620,7 @@ inline tensor stack_pop_v2(const tensor& handle, datatype elem_type) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22644,11 +22644,11 @@ inline tensor stack_push(const tensor& handle, const tensor& elem, bool swap_mem
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), elem.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), elem.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22672,11 +22672,11 @@ inline tensor stack_push_v2(const tensor& handle, const tensor& elem, bool swap_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), elem.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), elem.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22700,7 +22700,7 @@ inline tensor stack_v2(const tensor& max_size, datatype elem_type, const std::st
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), max_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), max_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22725,7 +22725,7 @@ inline tensor stage_peek(const tensor& index, const std::vector<datatype>& dtype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22778,23 +22778,23 @@ inline tensor stateful_random_binomial(const tensor& resource, const tensor& alg
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), algorithm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), algorithm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), counts.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), counts.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), probs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), probs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22819,11 +22819,11 @@ inline tensor stateful_standard_normal(const tensor& resource, const tensor& sha
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22848,15 +22848,15 @@ inline tensor stateful_standard_normal_v2(const tensor& resource, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), algorithm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), algorithm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22881,15 +22881,15 @@ inline tensor stateful_truncated_normal(const tensor& resource, const tensor& al
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), algorithm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), algorithm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22914,15 +22914,15 @@ inline tensor stateful_uniform(const tensor& resource, const tensor& algorithm,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), algorithm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), algorithm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22947,15 +22947,15 @@ inline tensor stateful_uniform_full_int(const tensor& resource, const tensor& al
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), algorithm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), algorithm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -22980,23 +22980,23 @@ inline tensor stateful_uniform_int(const tensor& resource, const tensor& algorit
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), algorithm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), algorithm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), minval.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), minval.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), maxval.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), maxval.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23021,15 +23021,15 @@ inline tensor stateless_multinomial(const tensor& logits, const tensor& num_samp
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), logits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), logits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_samples.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_samples.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23054,27 +23054,27 @@ inline tensor stateless_parameterized_truncated_normal(const tensor& shape, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), means.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), means.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), stddevs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), stddevs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), minvals.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), minvals.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), maxvals.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), maxvals.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23100,19 +23100,19 @@ inline tensor stateless_random_binomial(const tensor& shape, const tensor& seed,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), counts.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), counts.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), probs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), probs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23138,15 +23138,15 @@ inline tensor stateless_random_gamma_v2(const tensor& shape, const tensor& seed,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), alpha.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), alpha.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23171,11 +23171,11 @@ inline tensor stateless_random_normal(const tensor& shape, const tensor& seed, d
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23200,15 +23200,15 @@ inline tensor stateless_random_poisson(const tensor& shape, const tensor& seed,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lam.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lam.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23234,11 +23234,11 @@ inline tensor stateless_random_uniform(const tensor& shape, const tensor& seed,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23263,11 +23263,11 @@ inline tensor stateless_random_uniform_full_int(const tensor& shape, const tenso
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23292,19 +23292,19 @@ inline tensor stateless_random_uniform_int(const tensor& shape, const tensor& se
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), minval.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), minval.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), maxval.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), maxval.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23329,11 +23329,11 @@ inline tensor stateless_truncated_normal(const tensor& shape, const tensor& seed
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), seed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), seed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23358,7 +23358,7 @@ inline tensor static_regex_full_match(const tensor& input, const std::string& pa
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23382,7 +23382,7 @@ inline tensor static_regex_replace(const tensor& input, const std::string& patte
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23452,7 +23452,7 @@ inline tensor stats_aggregator_summary(const tensor& iterator) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), iterator.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), iterator.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23476,7 +23476,7 @@ inline tensor stop_gradient(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23500,19 +23500,19 @@ inline tensor strided_slice(const tensor& input, const tensor& begin, const tens
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), begin.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), begin.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), end.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), end.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), strides.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), strides.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23541,23 +23541,23 @@ inline tensor strided_slice_assign(const tensor& ref, const tensor& begin, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), ref.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), ref.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), begin.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), begin.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), end.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), end.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), strides.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), strides.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23586,23 +23586,23 @@ inline tensor strided_slice_grad(const tensor& shape, const tensor& begin, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), begin.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), begin.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), end.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), end.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), strides.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), strides.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dy.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dy.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23632,7 +23632,7 @@ inline tensor string_format(const std::vector<tensor>&inputs, const std::string&
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -23660,7 +23660,7 @@ inline tensor string_join(const std::vector<tensor>&inputs, const std::string& s
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -23686,7 +23686,7 @@ inline tensor string_length(const tensor& input, const std::string& unit="BYTE")
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23710,7 +23710,7 @@ inline tensor string_lower(const tensor& input, const std::string& encoding="")
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23734,7 +23734,7 @@ inline tensor string_strip(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23758,7 +23758,7 @@ inline tensor string_to_hash_bucket(const tensor& string_input_tensor, int64_t n
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), string_input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), string_input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23782,7 +23782,7 @@ inline tensor string_to_hash_bucket_fast(const tensor& input, int64_t num_bucket
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23806,7 +23806,7 @@ inline tensor string_to_hash_bucket_strong(const tensor& input, int64_t num_buck
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23831,7 +23831,7 @@ inline tensor string_to_number(const tensor& string_input_tensor, datatype out_t
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), string_input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), string_input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23855,7 +23855,7 @@ inline tensor string_upper(const tensor& input, const std::string& encoding="")
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23879,11 +23879,11 @@ inline tensor sub(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23907,15 +23907,15 @@ inline tensor substr(const tensor& input, const tensor& pos, const tensor& len,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), pos.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), pos.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), len.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), len.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23939,11 +23939,11 @@ inline tensor sum(const tensor& input, const tensor& reduction_indices, bool kee
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), reduction_indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), reduction_indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -23990,15 +23990,15 @@ inline tensor t_f_record_dataset(const tensor& filenames, const tensor& compress
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), compression_type.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), compression_type.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24089,11 +24089,11 @@ inline tensor t_p_u_embedding_activations(const tensor& embedding_variable, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), embedding_variable.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), embedding_variable.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), sliced_activations.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sliced_activations.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24140,7 +24140,7 @@ inline tensor t_p_u_replicated_input(const std::vector<tensor>&inputs, bool is_m
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> inputs_handles; inputs_handles.reserve(inputs.size());
-    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(inputs.begin(), inputs.end(), std::back_inserter(inputs_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), inputs_handles.data(), inputs.size(), context::get_status());
     status_check(context::get_status());
     
@@ -24168,7 +24168,7 @@ inline tensor t_p_u_replicated_output(const tensor& input, int64_t num_replicas)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24192,11 +24192,11 @@ inline tensor take_dataset(const tensor& input_dataset, const tensor& count, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), count.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), count.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24228,7 +24228,7 @@ inline tensor tan(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24252,7 +24252,7 @@ inline tensor tanh(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24276,11 +24276,11 @@ inline tensor tanh_grad(const tensor& y, const tensor& dy) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dy.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dy.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24330,7 +24330,7 @@ inline tensor tensor_array(const tensor& size, datatype dtype, const std::vector
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24361,15 +24361,15 @@ inline tensor tensor_array_gather(const tensor& handle, const tensor& indices, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24397,15 +24397,15 @@ inline tensor tensor_array_gather_v2(const tensor& handle, const tensor& indices
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24433,15 +24433,15 @@ inline tensor tensor_array_gather_v3(const tensor& handle, const tensor& indices
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24469,11 +24469,11 @@ inline tensor tensor_array_grad(const tensor& handle, const tensor& flow_in, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24497,11 +24497,11 @@ inline tensor tensor_array_grad_v2(const tensor& handle, const tensor& flow_in,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24525,11 +24525,11 @@ inline tensor tensor_array_pack(const tensor& handle, const tensor& flow_in, dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24557,15 +24557,15 @@ inline tensor tensor_array_read(const tensor& handle, const tensor& index, const
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24589,15 +24589,15 @@ inline tensor tensor_array_read_v2(const tensor& handle, const tensor& index, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24621,15 +24621,15 @@ inline tensor tensor_array_read_v3(const tensor& handle, const tensor& index, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24653,19 +24653,19 @@ inline tensor tensor_array_scatter(const tensor& handle, const tensor& indices,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24689,19 +24689,19 @@ inline tensor tensor_array_scatter_v2(const tensor& handle, const tensor& indice
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24725,19 +24725,19 @@ inline tensor tensor_array_scatter_v3(const tensor& handle, const tensor& indice
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24761,11 +24761,11 @@ inline tensor tensor_array_size(const tensor& handle, const tensor& flow_in) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24789,11 +24789,11 @@ inline tensor tensor_array_size_v2(const tensor& handle, const tensor& flow_in)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24817,11 +24817,11 @@ inline tensor tensor_array_size_v3(const tensor& handle, const tensor& flow_in)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24845,19 +24845,19 @@ inline tensor tensor_array_split(const tensor& handle, const tensor& value, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lengths.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lengths.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24881,19 +24881,19 @@ inline tensor tensor_array_split_v2(const tensor& handle, const tensor& value, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lengths.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lengths.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24917,19 +24917,19 @@ inline tensor tensor_array_split_v3(const tensor& handle, const tensor& value, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lengths.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lengths.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24953,15 +24953,15 @@ inline tensor tensor_array_unpack(const tensor& handle, const tensor& value, con
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -24985,7 +24985,7 @@ inline tensor tensor_array_v2(const tensor& size, datatype dtype, const std::vec
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25016,19 +25016,19 @@ inline tensor tensor_array_write(const tensor& handle, const tensor& index, cons
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25052,19 +25052,19 @@ inline tensor tensor_array_write_v2(const tensor& handle, const tensor& index, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25088,19 +25088,19 @@ inline tensor tensor_array_write_v3(const tensor& handle, const tensor& index, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), flow_in.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), flow_in.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25125,7 +25125,7 @@ inline tensor tensor_dataset(const std::vector<tensor>&components, const std::ve
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> components_handles; components_handles.reserve(components.size());
-    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), components_handles.data(), components.size(), context::get_status());
     status_check(context::get_status());
     
@@ -25158,11 +25158,11 @@ inline tensor tensor_list_concat_lists(const tensor& input_a, const tensor& inpu
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_a.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_a.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_b.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_b.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25186,7 +25186,7 @@ inline tensor tensor_list_element_shape(const tensor& input_handle, datatype sha
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25210,11 +25210,11 @@ inline tensor tensor_list_from_tensor(const tensor& input_tensor, const tensor&
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25239,15 +25239,15 @@ inline tensor tensor_list_gather(const tensor& input_handle, const tensor& indic
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25271,15 +25271,15 @@ inline tensor tensor_list_get_item(const tensor& input_handle, const tensor& ind
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25303,7 +25303,7 @@ inline tensor tensor_list_length(const tensor& input_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25327,11 +25327,11 @@ inline tensor tensor_list_push_back(const tensor& input_handle, const tensor& in
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25355,11 +25355,11 @@ inline tensor tensor_list_push_back_batch(const tensor& input_handles, const ten
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handles.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handles.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25383,11 +25383,11 @@ inline tensor tensor_list_reserve(const tensor& element_shape, const tensor& num
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_elements.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_elements.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25412,11 +25412,11 @@ inline tensor tensor_list_resize(const tensor& input_handle, const tensor& size)
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25440,15 +25440,15 @@ inline tensor tensor_list_scatter(const tensor& input_tensor, const tensor& indi
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25473,15 +25473,15 @@ inline tensor tensor_list_scatter_into_existing_list(const tensor& input_handle,
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25505,19 +25505,19 @@ inline tensor tensor_list_scatter_v2(const tensor& input_tensor, const tensor& i
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_elements.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_elements.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25542,15 +25542,15 @@ inline tensor tensor_list_set_item(const tensor& input_handle, const tensor& ind
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), item.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), item.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25574,15 +25574,15 @@ inline tensor tensor_list_split(const tensor& input_tensor, const tensor& elemen
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), lengths.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), lengths.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25607,11 +25607,11 @@ inline tensor tensor_list_stack(const tensor& input_handle, const tensor& elemen
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), element_shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), element_shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25636,15 +25636,15 @@ inline tensor tensor_scatter_add(const tensor& input_tensor, const tensor& indic
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25668,15 +25668,15 @@ inline tensor tensor_scatter_max(const tensor& input_tensor, const tensor& indic
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25700,15 +25700,15 @@ inline tensor tensor_scatter_min(const tensor& input_tensor, const tensor& indic
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25732,15 +25732,15 @@ inline tensor tensor_scatter_sub(const tensor& input_tensor, const tensor& indic
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25764,15 +25764,15 @@ inline tensor tensor_scatter_update(const tensor& input_tensor, const tensor& in
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), updates.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), updates.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25797,7 +25797,7 @@ inline tensor tensor_slice_dataset(const std::vector<tensor>&components, const s
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> components_handles; components_handles.reserve(components.size());
-    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(components.begin(), components.end(), std::back_inserter(components_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), components_handles.data(), components.size(), context::get_status());
     status_check(context::get_status());
     
@@ -25830,23 +25830,23 @@ inline tensor tensor_strided_slice_update(const tensor& input, const tensor& beg
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), begin.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), begin.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), end.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), end.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), strides.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), strides.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25875,7 +25875,7 @@ inline tensor tensor_summary(const tensor& input_tensor, const std::vector< std:
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25905,15 +25905,15 @@ inline tensor tensor_summary_v2(const tensor& tag, const tensor& input_tensor, c
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), tag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), tag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), serialized_summary_metadata.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), serialized_summary_metadata.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -25937,15 +25937,15 @@ inline tensor text_line_dataset(const tensor& filenames, const tensor& compressi
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), filenames.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), filenames.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), compression_type.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), compression_type.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), buffer_size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), buffer_size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26015,11 +26015,11 @@ inline tensor thread_pool_dataset(const tensor& input_dataset, const tensor& thr
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), thread_pool.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), thread_pool.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26076,11 +26076,11 @@ inline tensor tile(const tensor& input, const tensor& multiples, datatype Tmulti
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), multiples.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), multiples.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26104,11 +26104,11 @@ inline tensor tile_grad(const tensor& input, const tensor& multiples) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), multiples.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), multiples.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26153,7 +26153,7 @@ inline tensor to_bool(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26177,11 +26177,11 @@ inline tensor transpose(const tensor& x, const tensor& perm, datatype Tperm=stat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), perm.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), perm.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26205,19 +26205,19 @@ inline tensor tridiagonal_mat_mul(const tensor& superdiag, const tensor& maindia
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), superdiag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), superdiag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), maindiag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), maindiag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), subdiag.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), subdiag.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26241,11 +26241,11 @@ inline tensor tridiagonal_solve(const tensor& diagonals, const tensor& rhs, bool
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), diagonals.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), diagonals.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), rhs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), rhs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26269,11 +26269,11 @@ inline tensor truncate_div(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26297,11 +26297,11 @@ inline tensor truncate_mod(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26325,7 +26325,7 @@ inline tensor truncated_normal(const tensor& shape, datatype dtype, int64_t seed
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), shape.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shape.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26351,15 +26351,15 @@ inline tensor unbatch(const tensor& batched_input_tensor, const tensor& batch_in
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), batched_input_tensor.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batched_input_tensor.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), id.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), id.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26385,7 +26385,7 @@ inline tensor unbatch_dataset(const tensor& input_dataset, const std::vector<dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26417,19 +26417,19 @@ inline tensor unbatch_grad(const tensor& original_input, const tensor& batch_ind
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), original_input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), original_input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), batch_index.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), batch_index.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), grad.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), grad.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), id.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), id.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26454,7 +26454,7 @@ inline tensor uncompress_element(const tensor& compressed, const std::vector<dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), compressed.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), compressed.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26486,11 +26486,11 @@ inline tensor unicode_encode(const tensor& input_values, const tensor& input_spl
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), input_splits.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_splits.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26517,7 +26517,7 @@ inline tensor unicode_script(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26541,7 +26541,7 @@ inline tensor unicode_transcode(const tensor& input, const std::string& input_en
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26569,7 +26569,7 @@ inline tensor unique_dataset(const tensor& input_dataset, const std::vector<data
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26601,7 +26601,7 @@ inline tensor unpack(const tensor& value, int64_t num, int64_t axis=0) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), value.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), value.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26626,11 +26626,11 @@ inline tensor unravel_index(const tensor& indices, const tensor& dims, datatype
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), indices.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), indices.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), dims.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), dims.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26654,15 +26654,15 @@ inline tensor unsorted_segment_join(const tensor& inputs, const tensor& segment_
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26688,15 +26688,15 @@ inline tensor unsorted_segment_max(const tensor& data, const tensor& segment_ids
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26721,15 +26721,15 @@ inline tensor unsorted_segment_min(const tensor& data, const tensor& segment_ids
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26754,15 +26754,15 @@ inline tensor unsorted_segment_prod(const tensor& data, const tensor& segment_id
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26787,15 +26787,15 @@ inline tensor unsorted_segment_sum(const tensor& data, const tensor& segment_ids
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), data.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), data.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), segment_ids.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), segment_ids.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), num_segments.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), num_segments.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26845,7 +26845,7 @@ inline tensor unwrap_dataset_variant(const tensor& input_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26869,11 +26869,11 @@ inline tensor upper_bound(const tensor& sorted_inputs, const tensor& values, dat
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), sorted_inputs.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), sorted_inputs.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), values.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), values.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26929,7 +26929,7 @@ inline tensor var_is_initialized_op(const tensor& resource) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), resource.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), resource.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -26980,7 +26980,7 @@ inline tensor variable_shape(const tensor& input, datatype out_type=static_cast<
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27031,7 +27031,7 @@ inline tensor where(const tensor& input) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27099,23 +27099,23 @@ inline tensor window_dataset(const tensor& input_dataset, const tensor& size, co
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_dataset.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_dataset.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), size.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), size.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), shift.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), shift.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), stride.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), stride.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), drop_remainder.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), drop_remainder.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27147,7 +27147,7 @@ inline tensor worker_heartbeat(const tensor& request) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), request.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), request.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27171,7 +27171,7 @@ inline tensor wrap_dataset_variant(const tensor& input_handle) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), input_handle.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), input_handle.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27195,11 +27195,11 @@ inline tensor xdivy(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27223,11 +27223,11 @@ inline tensor xlog1py(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27251,11 +27251,11 @@ inline tensor xlogy(const tensor& x, const tensor& y) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), y.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), y.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27279,7 +27279,7 @@ inline tensor zeros_like(const tensor& x) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27303,11 +27303,11 @@ inline tensor zeta(const tensor& x, const tensor& q) {
 
     // Required input arguments
     
-    TFE_OpAddInput(op.get(), x.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), x.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
     
-    TFE_OpAddInput(op.get(), q.tfe_handle.get(), context::get_status());
+    TFE_OpAddInput(op.get(), q.get_eager_handle().get(), context::get_status());
     status_check(context::get_status());
     
 
@@ -27332,7 +27332,7 @@ inline tensor zip_dataset(const std::vector<tensor>&input_datasets, const std::v
     // Required input arguments
     
     std::vector<TFE_TensorHandle*> input_datasets_handles; input_datasets_handles.reserve(input_datasets.size());
-    std::transform(input_datasets.begin(), input_datasets.end(), std::back_inserter(input_datasets_handles), [](const auto& t) { return t.tfe_handle.get();});
+    std::transform(input_datasets.begin(), input_datasets.end(), std::back_inserter(input_datasets_handles), [](const auto& t) { return t.get_eager_handle().get();});
     TFE_OpAddInputList(op.get(), input_datasets_handles.data(), input_datasets.size(), context::get_status());
     status_check(context::get_status());
     
@@ -0,0 +1,234 @@
+#ifndef CPPFLOW2_SIGNATURE_H
+#define CPPFLOW2_SIGNATURE_H
+
+#include <tensorflow/c/c_api.h>
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "datatype.h"
+#include "proto.h"
+
+namespace cppflow {
+
+    /**
+     * One input or output of a signature, resolved against the graph when the model loads
+     */
+    struct signature_tensor {
+        /// Key in the signature, e.g. "conv2d_input"
+        std::string key;
+        /// Graph tensor it maps to, e.g. "serving_default_conv2d_input:0"
+        std::string name;
+        datatype dtype;
+        /// -1 for dimensions that are not fixed, empty if the rank is unknown
+        std::vector<int64_t> shape;
+        TF_Output output;
+    };
+
+    /**
+     * The inputs and outputs of a serving signature, ordered by key
+     */
+    struct signature {
+        std::string method_name;
+        std::vector<signature_tensor> inputs;
+        std::vector<signature_tensor> outputs;
+
+        const signature_tensor& input(const std::string& key) const;
+        const signature_tensor& output(const std::string& key) const;
+    };
+
+    /**
+     * Reads the signature_def map of a serialized MetaGraphDef
+     * @param data The MetaGraphDef returned by TF_LoadSessionFromSavedModel
+     * @param size Length of data
+     * @param graph Graph the tensor names are resolved against
+     * @return Signatures by name, e.g. "serving_default"
+     */
+    std::map<std::string, signature> parse_signatures(const void* data, size_t size, TF_Graph* graph);
+
+    /**
+     * Builds a signature for a graph that has none, such as a frozen GraphDef:
+     * its placeholders are the inputs and the outputs nothing consumes are the outputs
+     */
+    signature infer_signature(TF_Graph* graph);
+}
+
+
+/******************************
+ *   IMPLEMENTATION DETAILS   *
+ ******************************/
+
+
+namespace cppflow {
+
+    inline const signature_tensor& signature::input(const std::string& key) const {
+        for (const auto& t : this->inputs)
+            if (t.key == key)
+                return t;
+        throw std::runtime_error("No signature input named \"" + key + "\"");
+    }
+
+    inline const signature_tensor& signature::output(const std::string& key) const {
+        for (const auto& t : this->outputs)
+            if (t.key == key)
+                return t;
+        throw std::runtime_error("No signature output named \"" + key + "\"");
+    }
+
+    inline TF_Output resolve_output(TF_Graph* graph, const std::string& name) {
+        auto idx = name.find(':');
+        std::string op_name = name.substr(0, idx);
+
+        TF_Output result;
+        result.oper = TF_GraphOperationByName(graph, op_name.c_str());
+        result.index = idx == std::string::npos ? 0 : std::stoi(name.substr(idx + 1));
+
+        if (!result.oper)
+            throw std::runtime_error("Signature refers to \"" + name + "\" but no such operation exists");
+
+        return result;
+    }
+
+    inline signature_tensor parse_tensor_info(const std::string& key, proto_reader info, TF_Graph* graph) {
+        // TensorInfo { name: 1, dtype: 2, tensor_shape: 3 }
+        signature_tensor result;
+        result.key = key;
+        result.dtype = TF_FLOAT;
+
+        while (info.next()) {
+            if (info.field() == 1) {
+                result.name = info.string();
+            }
+            else if (info.field() == 2) {
+                result.dtype = static_cast<datatype>(info.varint());
+            }
+            else if (info.field() == 3) {
+                // TensorShapeProto { dim: 2 { size: 1 }, unknown_rank: 3 }
+                auto shape = info.message();
+                while (shape.next()) {
+                    if (shape.field() == 2) {
+                        int64_t size = -1;
+                        auto dim = shape.message();
+                        while (dim.next())
+                            if (dim.field() == 1)
+                                size = static_cast<int64_t>(dim.varint());
+                        result.shape.push_back(size);
+                    }
+                    else if (shape.field() == 3 && shape.varint()) {
+                        result.shape.clear();
+                        break;
+                    }
+                }
+            }
+        }
+
+        result.output = resolve_output(graph, result.name);
+        return result;
+    }
+
+    inline std::map<std::string, signature> parse_signatures(const void* data, size_t size, TF_Graph* graph) {
+        std::map<std::string, signature> result;
+
+        // MetaGraphDef { signature_def: 5 map<string, SignatureDef> }
+        proto_reader meta_graph(data, size);
+        while (meta_graph.next()) {
+            if (meta_graph.field() != 5)
+                continue;
+
+            std::string name;
+            signature sig;
+
+            auto entry = meta_graph.message();
+            while (entry.next()) {
+                if (entry.field() == 1) {
+                    name = entry.string();
+                }
+                else if (entry.field() == 2) {
+                    // SignatureDef { inputs: 1, outputs: 2, method_name: 3 }, both maps of TensorInfo
+                    auto def = entry.message();
+                    while (def.next()) {
+                        if (def.field() == 3) {
+                            sig.method_name = def.string();
+                            continue;
+                        }
+                        if (def.field() != 1 && def.field() != 2)
+                            continue;
+
+                        std::string key;
+                        auto tensor_entry = def.message();
+                        proto_reader info(nullptr, 0);
+                        while (tensor_entry.next()) {
+                            if (tensor_entry.field() == 1)
+                                key = tensor_entry.string();
+                            else if (tensor_entry.field() == 2)
+                                info = tensor_entry.message();
+                        }
+
+                        auto& side = def.field() == 1 ? sig.inputs : sig.outputs;
+                        side.push_back(parse_tensor_info(key, info, graph));
+                    }
+                }
+            }
+
+            auto by_key = [](const signature_tensor& a, const signature_tensor& b) { return a.key < b.key; };
+            std::sort(sig.inputs.begin(), sig.inputs.end(), by_key);
+            std::sort(sig.outputs.begin(), sig.outputs.end(), by_key);
+
+            result[name] = std::move(sig);
+        }
+
+        return result;
+    }
+
+    inline signature infer_signature(TF_Graph* graph) {
+        signature result;
+        result.method_name = "tensorflow/serving/predict";
+
+        auto status = std::unique_ptr<TF_Status, decltype(&TF_DeleteStatus)>(TF_NewStatus(), TF_DeleteStatus);
+
+        auto describe = [&](TF_Output out) {
+            signature_tensor t;
+            t.key = TF_OperationName(out.oper);
+            t.name = t.key + ":" + std::to_string(out.index);
+            t.dtype = TF_OperationOutputType(out);
+            t.output = out;
+
+            int n_dims = TF_GraphGetTensorNumDims(graph, out, status.get());
+            if (TF_GetCode(status.get()) == TF_OK && n_dims > 0) {
+                t.shape.resize(n_dims);
+                TF_GraphGetTensorShape(graph, out, t.shape.data(), n_dims, status.get());
+                if (TF_GetCode(status.get()) != TF_OK)
+                    t.shape.clear();
+            }
+            return t;
+        };
+
+        size_t pos = 0;
+        TF_Operation* oper;
+        while ((oper = TF_GraphNextOperation(graph, &pos)) != nullptr) {
+            std::string type = TF_OperationOpType(oper);
+
+            if (type == "Placeholder") {
+                result.inputs.push_back(describe({oper, 0}));
+                continue;
+            }
+            if (type == "Const" || type == "NoOp")
+                continue;
+
+            for (int i = 0; i < TF_OperationNumOutputs(oper); i++) {
+                if (TF_OperationOutputNumConsumers({oper, i}) == 0)
+                    result.outputs.push_back(describe({oper, i}));
+            }
+        }
+
+        auto by_key = [](const signature_tensor& a, const signature_tensor& b) { return a.key < b.key; };
+        std::sort(result.inputs.begin(), result.inputs.end(), by_key);
+        std::sort(result.outputs.begin(), result.outputs.end(), by_key);
+
+        return result;
+    }
+}
+
+#endif //CPPFLOW2_SIGNATURE_H
@@ -3,16 +3,61 @@
 
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <string>
 #include <tensorflow/c/tf_tensor.h>
 #include <tensorflow/c/eager/c_api.h>
 
+// cv::Mat adapters are only available when OpenCV is on the include path
+#if __has_include(<opencv2/core.hpp>)
+#include <opencv2/core.hpp>
+#define CPPFLOW_HAS_OPENCV
+#endif
+
 #include "context.h"
 #include "datatype.h"
 
 namespace cppflow {
 
+    /**
+     * @class tensor_view
+     * @brief A typed, read only view straight into the data of a tensor
+     *
+     * The view shares ownership of the underlying TF_Tensor, so it stays valid even if the tensor it came from is destroyed.
+     */
+    template<typename T>
+    class tensor_view {
+    public:
+        tensor_view(std::shared_ptr<TF_Tensor> owner, std::vector<int64_t> shape);
+
+        /**
+         * @return Pointer to the first element
+         */
+        const T* data() const { return ptr; }
+
+        /**
+         * @return Number of elements
+         */
+        size_t size() const { return count; }
+
+        /**
+         * @return Shape of the tensor
+         */
+        const std::vector<int64_t>& shape() const { return dims; }
+
+        const T& operator[](size_t i) const { return ptr[i]; }
+        const T* begin() const { return ptr; }
+        const T* end() const { return ptr + count; }
+
+    private:
+        std::shared_ptr<TF_Tensor> owner;
+        std::vector<int64_t> dims;
+        const T* ptr;
+        size_t count;
+    };
+
     /**
      * @class tensor
      * @brief A TensorFlow eager tensor wrapper
@@ -73,6 +118,34 @@ namespace cppflow {
         template<typename T>
         std::vector<T> get_data() const;
 
+        /**
+         * Views the tensor data in place, without the copy get_data makes
+         * @tparam T The c++ type (must be equivalent to the tensor type)
+         * @return A view sharing ownership of the tensor data
+         */
+        template<typename T>
+        tensor_view<T> view() const;
+
+#ifdef CPPFLOW_HAS_OPENCV
+        /**
+         * Wraps the data of a continuous cv::Mat without copying it. The tensor keeps a reference
+         * to the Mat, so the pixels stay alive for as long as TensorFlow uses them.
+         * NOTE: Only data on a 64 byte boundary is wrapped. Continuous ROIs and Mats over user data
+         * can start anywhere, those are copied into an aligned buffer instead.
+         * @param mat A continuous matrix, its depth picks the tensor datatype
+         * @param shape The shape of the tensor, by default the Mat dimensions followed by its channels
+         * @return A tensor sharing the Mat data
+         */
+        static tensor from_mat(const cv::Mat& mat, std::vector<int64_t> shape = {});
+
+        /**
+         * Views the tensor data as a cv::Mat with one dimension per tensor dimension, without copying.
+         * The Mat does not own the data: it is only valid while this tensor is alive and must not be modified.
+         * @return A Mat header over the tensor data
+         */
+        cv::Mat to_mat() const;
+#endif
+
 
         ~tensor() = default;
         tensor(const tensor &tensor) = default;
@@ -91,8 +164,11 @@ namespace cppflow {
         // Additional NOTE: TF_Tensor is an immutable tensor inside tensorflow.
         // TFE_TensorHandle is a TF_Tensor and the associated device, plus some data cache
         
+        // Tensors built from data or from a TF_Tensor (e.g. session inputs and outputs) only create
+        // their eager handle here, the first time an eager op needs it. Graph session runs never do.
+        // NOTE: Not thread safe, do not call on the same tensor from several threads.
         // TODO: Need to determine if we can mark the return value or *this as const
-        std::shared_ptr<TFE_TensorHandle> get_eager_handle() const { return tfe_handle; }
+        std::shared_ptr<TFE_TensorHandle> get_eager_handle() const;
 
         // Get the TF_Tensor data from the eager handle
         // Call `get_data<T>()` instead if possible
@@ -101,12 +177,13 @@ namespace cppflow {
         //       See comments of `tf_tensor` for more details.
         std::shared_ptr<TF_Tensor> get_tensor() const;
         
-        // DO NOT directly access this member, call get_eager_handle() instead
+        // DO NOT directly access this member, call get_eager_handle() instead (it may not be created yet)
         // TODO: This is kept as public to be compatible with existing code and should be mark as private
-        std::shared_ptr<TFE_TensorHandle> tfe_handle;
+        mutable std::shared_ptr<TFE_TensorHandle> tfe_handle;
 
     private:
         // This member serves as a local cache of the data in tfe_handle.
+        // For tensors that started out as a TF_Tensor it is the primary copy and tfe_handle is created lazily.
         // It refers to `local_mirrors_` if on device, or `data_` if on host CPU.
         // Changes to this variable may not be reflected in the actual device memory,
         // e.g. on GPUs or on remote nodes.
@@ -128,8 +205,6 @@ namespace cppflow {
     inline tensor::tensor(enum TF_DataType type, const void *data, size_t len, const std::vector<int64_t> &shape) {
         this->tf_tensor = {TF_AllocateTensor(type, shape.data(), shape.size(), len), TF_DeleteTensor};
         memcpy(TF_TensorData(this->tf_tensor.get()), data, TF_TensorByteSize(this->tf_tensor.get()));
-        this->tfe_handle = {TFE_NewTensorHandle(this->tf_tensor.get(), context::get_status()), TFE_DeleteTensorHandle};
-        status_check(context::get_status());
     }
 
     template<typename T>
@@ -174,15 +249,21 @@ namespace cppflow {
 
     inline tensor::tensor(TF_Tensor* t) {
         this->tf_tensor = {t, TF_DeleteTensor};
-        this->tfe_handle = {TFE_NewTensorHandle(this->tf_tensor.get(), context::get_status()), TFE_DeleteTensorHandle};
-        status_check(context::get_status());
+    }
+
+    inline std::shared_ptr<TFE_TensorHandle> tensor::get_eager_handle() const {
+        if (!tfe_handle && tf_tensor) {
+            tfe_handle = {TFE_NewTensorHandle(tf_tensor.get(), context::get_status()), TFE_DeleteTensorHandle};
+            status_check(context::get_status());
+        }
+        return tfe_handle;
     }
 
     inline tensor tensor::shape() const {
         auto op = TFE_NewOp(context::get_context(), "Shape", context::get_status());
         status_check(context::get_status());
 
-        TFE_OpAddInput(op, this->tfe_handle.get(), context::get_status());
+        TFE_OpAddInput(op, this->get_eager_handle().get(), context::get_status());
         status_check(context::get_status());
 
         // Output type should be int64_t
@@ -201,9 +282,9 @@ namespace cppflow {
     inline std::string tensor::device(bool on_memory) const {
         std::string res;
         if (on_memory)
-            res = TFE_TensorHandleBackingDeviceName(this->tfe_handle.get(), context::get_status());
+            res = TFE_TensorHandleBackingDeviceName(this->get_eager_handle().get(), context::get_status());
         else
-            res = std::string(TFE_TensorHandleDeviceName(this->tfe_handle.get(), context::get_status()));
+            res = std::string(TFE_TensorHandleDeviceName(this->get_eager_handle().get(), context::get_status()));
 
         status_check(context::get_status());
         return res;
@@ -236,7 +317,125 @@ namespace cppflow {
         return r;
     }
 
+#ifdef CPPFLOW_HAS_OPENCV
+    inline datatype mat_depth_to_dtype(int depth) {
+        switch (depth) {
+            case CV_8U: return TF_UINT8;
+            case CV_8S: return TF_INT8;
+            case CV_16U: return TF_UINT16;
+            case CV_16S: return TF_INT16;
+            case CV_32S: return TF_INT32;
+            case CV_32F: return TF_FLOAT;
+            case CV_64F: return TF_DOUBLE;
+            case CV_16F: return TF_HALF;
+        }
+        throw std::runtime_error("cv::Mat depth " + std::to_string(depth) + " has no tensor datatype");
+    }
+
+    inline int dtype_to_mat_depth(datatype type) {
+        switch (type) {
+            case TF_UINT8: return CV_8U;
+            case TF_INT8: return CV_8S;
+            case TF_UINT16: return CV_16U;
+            case TF_INT16: return CV_16S;
+            case TF_INT32: return CV_32S;
+            case TF_FLOAT: return CV_32F;
+            case TF_DOUBLE: return CV_64F;
+            case TF_HALF: return CV_16F;
+            default: break;
+        }
+        throw std::runtime_error("Tensor datatype " + cppflow::to_string(type) + " has no cv::Mat depth");
+    }
+
+    inline tensor tensor::from_mat(const cv::Mat& mat, std::vector<int64_t> shape) {
+        if (!mat.isContinuous())
+            throw std::runtime_error("from_mat needs a continuous cv::Mat, clone() it first");
+
+        if (shape.empty()) {
+            for (int i = 0; i < mat.dims; i++)
+                shape.push_back(mat.size[i]);
+            if (mat.channels() > 1)
+                shape.push_back(mat.channels());
+        }
+
+        size_t bytes = mat.total() * mat.elemSize();
+        auto dtype = mat_depth_to_dtype(mat.depth());
+
+        // TensorFlow's kernels assume 64 byte aligned buffers, so anything else goes into one that is
+        if (reinterpret_cast<uintptr_t>(mat.data) % 64 != 0) {
+            void* aligned = std::aligned_alloc(64, (bytes + 63) / 64 * 64);
+            if (!aligned)
+                throw std::bad_alloc();
+            std::memcpy(aligned, mat.data, bytes);
+
+            // On failure TF_NewTensor has already called the deallocator
+            auto release = [](void* data, size_t, void*) { std::free(data); };
+            TF_Tensor* t = TF_NewTensor(dtype, shape.data(), static_cast<int>(shape.size()), aligned, bytes, release, nullptr);
+            if (!t)
+                throw std::runtime_error("Shape passed to from_mat does not match the cv::Mat size");
+
+            return tensor(t);
+        }
+
+        // The extra reference is released by the deallocator once TensorFlow is done with the data
+        auto* owner = new cv::Mat(mat);
+        auto deallocator = [](void*, size_t, void* arg) { delete static_cast<cv::Mat*>(arg); };
+
+        // On failure TF_NewTensor has already called the deallocator
+        TF_Tensor* t = TF_NewTensor(dtype, shape.data(), static_cast<int>(shape.size()),
+                                    owner->data, bytes, deallocator, owner);
+        if (!t)
+            throw std::runtime_error("Shape passed to from_mat does not match the cv::Mat size");
+
+        return tensor(t);
+    }
+
+    inline cv::Mat tensor::to_mat() const {
+        auto res_tensor = get_tensor();
+
+        std::vector<int> sizes;
+        for (int i = 0; i < TF_NumDims(res_tensor.get()); i++)
+            sizes.push_back(static_cast<int>(TF_Dim(res_tensor.get(), i)));
+
+        // Scalars become a 1x1 Mat
+        if (sizes.empty())
+            sizes.push_back(1);
+
+        return cv::Mat(static_cast<int>(sizes.size()), sizes.data(), dtype_to_mat_depth(TF_TensorType(res_tensor.get())),
+                       TF_TensorData(res_tensor.get()));
+    }
+#endif
+
+    template<typename T>
+    tensor_view<T>::tensor_view(std::shared_ptr<TF_Tensor> owner, std::vector<int64_t> shape) :
+        owner(std::move(owner)), dims(std::move(shape)) {
+        this->ptr = static_cast<const T*>(TF_TensorData(this->owner.get()));
+        this->count = TF_TensorByteSize(this->owner.get()) / sizeof(T);
+    }
+
+    template<typename T>
+    tensor_view<T> tensor::view() const {
+        auto res_tensor = get_tensor();
+
+        // Check if asked datatype and tensor datatype match, without going through the eager handle
+        if (TF_TensorType(res_tensor.get()) != deduce_tf_type<T>()) {
+            auto type1 = cppflow::to_string(deduce_tf_type<T>());
+            auto type2 = cppflow::to_string(TF_TensorType(res_tensor.get()));
+            auto error = "Datatype in function view (" + type1 + ") does not match tensor datatype (" + type2 + ")";
+            throw std::runtime_error(error);
+        }
+
+        std::vector<int64_t> shape(TF_NumDims(res_tensor.get()));
+        for (size_t i = 0; i < shape.size(); i++)
+            shape[i] = TF_Dim(res_tensor.get(), static_cast<int>(i));
+
+        return tensor_view<T>(res_tensor, shape);
+    }
+
     inline datatype tensor::dtype() const {
+        // Host tensors know their type without an eager handle
+        if (tf_tensor)
+            return TF_TensorType(tf_tensor.get());
         return TFE_TensorHandleDataType(this->tfe_handle.get());
     }
     
@@ -8,7 +8,11 @@
 
 // please always change this when producing a new build on a new machine
 #define FACE_MODEL_LOCATION "~ /haarcascade_frontalface_alt.xml"
+// compact copy of the face cascade, written next to the XML on first run (or by tools/bbtool)
+#define FACE_CACHE_LOCATION "~/haarcascade_frontalface_alt.bbc"
 #define MASK_MODEL_LOCATION "~/mask-detect-009.model"
+// a location ending in .pb is loaded as a frozen graph from tools/freeze_model.py
+// the input and output are read from the model's serving signature, so retrained models need no changes here
 
 // reports and videos will go to this folder
 #define OUTPUT_FOLDER "~/Downloads"
@@ -16,6 +20,65 @@
 // used to standardize the face images to match the input the model is expecting
 #define IMG_SIZE 150
 
+// largest number of faces sent to the mask model in one call, smaller batches use the next power of two
+#define MAX_BATCH_SIZE 32
+
+// runtime the mask model runs on: auto (from the extension), tensorflow, opencv,
+// tflite (built with CONFIG+=tflite) or onnxruntime (built with CONFIG+=onnxruntime)
+// BIGBROTHER_MASK_BACKEND overrides this at launch
+#define MASK_BACKEND "auto"
+
+// sessions the mask model is spread over and the threads each one uses, 0 threads lets TensorFlow decide
+// BIGBROTHER_MASK_SESSIONS, BIGBROTHER_INTRA_OP_THREADS and BIGBROTHER_INTER_OP_THREADS override these at launch
+#define MASK_SESSIONS 1
+#define MASK_INTRA_OP_THREADS 0
+#define MASK_INTER_OP_THREADS 0
+
+// ONNX Runtime graph optimization (disable, basic, extended or all) and whether inputs and outputs are bound to preallocated buffers
+// BIGBROTHER_ORT_OPTIMIZATION and BIGBROTHER_ORT_IO_BINDING override these at launch
+#define MASK_ORT_OPTIMIZATION "all"
+#define MASK_ORT_IO_BINDING 1
+
+// cheap first stage in front of the mask model, off by default
+// with it on, only faces whose lower face score is within MASK_CASCADE_BAND of the sensitivity go to the model
+// BIGBROTHER_MASK_CASCADE and BIGBROTHER_MASK_CASCADE_BAND override these at launch
+#define MASK_CASCADE 0
+#define MASK_CASCADE_BAND 0.15
+
+// faces remembered by the probability cache (0 turns it off), how many of the 64 dHash bits may differ for a hit,
+// and how often a hit is run through the model anyway to measure the cache's error
+// BIGBROTHER_MASK_CACHE_SIZE and BIGBROTHER_MASK_CACHE_TOLERANCE override the first two at launch
+#define MASK_CACHE_SIZE 0
+#define MASK_CACHE_TOLERANCE 4
+#define MASK_CACHE_VERIFY_EVERY 50
+
+// bins of the probability histogram drawn next to the sensitivity and exported with the report
+#define MASK_HISTOGRAM_BINS 20
+
+// resolution of the stored probabilities that compliance is recomputed from when the sensitivity changes
+#define PROBABILITY_BINS 1000
+
+// crops below these are not sent to the mask model, tracked faces keep their last result until a better frame
+// size is the shorter side of the box at detection scale, sharpness the variance of the Laplacian with crops over 64 pixels shrunk to 64 (the threshold rises for smaller crops), brightness the mean grey level
+#define FACE_MIN_SIZE 36
+#define FACE_MIN_SHARPNESS 40.0
+#define FACE_MIN_BRIGHTNESS 40.0
+#define FACE_MAX_BRIGHTNESS 220.0
+
+// milliseconds of mask inference per frame, faces that do not fit keep their tracked result (0 scores every face)
+// new faces are scored first, then results older than MASK_STALE_FRAMES, then results within MASK_NEAR_THRESHOLD of the sensitivity
+// BIGBROTHER_FRAME_BUDGET_MS overrides the budget at launch
+#define MASK_FRAME_BUDGET_MS 15.0
+#define MASK_STALE_FRAMES 15
+#define MASK_NEAR_THRESHOLD 0.15
+
+// faces per frame the per-frame arrays are sized for, busier frames grow them once
+#define MAX_FACES_PER_FRAME 64
+
+// a box continues a track when it overlaps it by this much, tracks unseen for more frames than this are dropped
+#define TRACK_MIN_OVERLAP 0.3
+#define TRACK_MAX_MISSED 10
+
 // used to scale down images for processing to speed up since less data points are used
 #define RESIZE_SCALE 4.0
 
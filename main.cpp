@@ -10,6 +10,9 @@
 
 int main(int argc, char *argv[])
 {
+  // start the camera, cascade and model in the background before anything else
+  Startup::getInstance()->begin();
+
   QApplication app(argc, argv);
   MainWindow mainWindow;
   mainWindow.showMaximized();
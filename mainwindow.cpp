@@ -13,14 +13,12 @@ using namespace std;
 
 // global variables are declared because they need to be accessed within a class' lambda function for painting the screen which cannot be edited
 // therefore we cannot include the relavent classes in that file to maintain OOP best practices in this case
-VideoCapture cap(0);
-
 QLabel *imageFeed;
 QLabel *compliancePercentLabel;
 QLabel *peopleNumberLabel;
+QLabel *modelStatusLabel;
+HistogramWidget *histogramWidget;
 
-float noMaskCount = 0.0;
-float maskCount = 0.0;
 float compliancePercent = 0.0;
 
 bool paused = false;
@@ -32,6 +30,19 @@ Mat initialFrame;
 int zoomValue = 0;
 int maxPeople = 0;
 
+// crops the quality gate kept from the model
+long lowQualityCount = 0;
+
+// latest face that went through classification, for the status label
+MaskResult lastResult;
+
+// faces of the current frame, reused so a frame allocates nothing per face
+FaceBatch faceBatch;
+
+// what is shown and what is recorded, reused from frame to frame
+Mat displayFrame;
+Mat recordFrame;
+
 /**
  * @brief Sets up the main window for the Qt interface, which uses a grid layout to organize the design
  *
@@ -41,24 +52,17 @@ int maxPeople = 0;
 MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
 {
     
-    // do camera initialization on first paint
-    if(!cap.isOpened()){
-        cap.open(0);
-        cap >> initialFrame;
-    }
+    // the camera, cascade and model come up in the background, poll them so the window can show straight away
+    cameraChecked = false;
+    startupTimer = new QTimer;
+    startupTimer->setInterval(50);
+    connect(startupTimer,SIGNAL(timeout()),this,SLOT(startupProgress()));
+    startupTimer->start();
 
     // ensures the frame is repainted and updated every 20ms to make the video feed live
     timer = new QTimer;
     timer->setInterval(20);
     connect(timer,SIGNAL(timeout()),this,SLOT(update()));
-    
-    // check if the video feed is initialized
-    if(!cap.isOpened()){
-        QMessageBox::critical(
-            this,
-            tr("Big Brother"),
-            tr("Could not initialize camera, please check to see if your camera is installed properly."));
-    }
 
     // holds the content for the main page
     QWidget *mainPage = new QWidget;
@@ -90,6 +94,30 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
     peopleNumberLabel = new QLabel;
     peopleNumberLabel->setStyleSheet("font-weight: bold; font-size: 20px; text-align: center;");
     peopleNumberLabel->setText("0");
+    
+    modelLabel = new QLabel;
+    modelLabel->setText("Mask Model");
+    modelLabel->setStyleSheet("font-weight: bold; font-size: 14px;");
+    
+    // the model loads in the background, faces are shown as pending until it is ready
+    modelStatusLabel = new QLabel;
+    modelStatusLabel->setStyleSheet("font-size: 14px;");
+    modelStatusLabel->setText("Model loading...");
+    modelStatusLabel->setWordWrap(true);
+    
+    // load model button, swaps the new version in without stopping the feed
+    loadModelButton = new QPushButton("Load Model...");
+    connect(loadModelButton, &QPushButton::released, this, &MainWindow::loadModelClicked);
+    // the first version is still loading, only one load runs at a time
+    loadModelButton->setEnabled(false);
+    modelLoadTimer = new QTimer;
+    modelLoadTimer->setInterval(100);
+    connect(modelLoadTimer,SIGNAL(timeout()),this,SLOT(modelLoadProgress()));
+    modelLoadTimer->start();
+    
+    // rollback button, goes back to the version that ran before the last swap
+    rollbackButton = new QPushButton("Roll Back Model");
+    connect(rollbackButton, &QPushButton::released, this, &MainWindow::rollbackClicked);
 
     // pause button
     pauseButton = new QPushButton("Pause");
@@ -117,11 +145,9 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
     zoomSlider = new QSlider(Qt::Horizontal);
     connect(zoomSlider, &QSlider::valueChanged, this, &MainWindow::sliderChanged);
     
-    // allow up to a 8x zoom based on height
-    int zoomX = initialFrame.size().height;
-    
+    // the maximum is set from the first frame once the camera is open
     zoomSlider->setMinimum(0);
-    zoomSlider->setMaximum(zoomX);
+    zoomSlider->setMaximum(0);
     zoomSlider->setValue(0);
     zoomSlider->setTickPosition(QSlider::TicksBelow);
     zoomSlider->setTickInterval(50);
@@ -131,6 +157,9 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
     sensitivityLabel->setStyleSheet("font-weight: bold; font-size: 16px;");
     sensitivityLabel->setText("Mask Detection Sensitivity");
     
+    // distribution of mask probabilities, to pick the sensitivity from
+    histogramWidget = new HistogramWidget(MaskDetector::getInstance()->getProbabilityStore());
+    
     // setup sensitivity
     sensitivityInput = new QDoubleSpinBox;
     connect(sensitivityInput, &QDoubleSpinBox::valueChanged, this, &MainWindow::sensitivityChanged);
@@ -170,18 +199,106 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
     mainLayout->addWidget(zoomSlider, 7, 2, 1, 1);
     
     mainLayout->addWidget(sensitivityLabel, 8, 2, 1, 1);
-    mainLayout->addWidget(sensitivityInput, 9, 2, 1, 1);
+    QHBoxLayout *sensitivityRow = new QHBoxLayout;
+    sensitivityRow->addWidget(sensitivityInput);
+    sensitivityRow->addWidget(histogramWidget, 1);
+    mainLayout->addLayout(sensitivityRow, 9, 2, 1, 1);
 
     mainLayout->addWidget(pauseButton, 10, 2, 1, 1);
     mainLayout->addWidget(recordButton, 11, 2, 1, 1);
     
     mainLayout->addWidget(exportButton, 12, 2, 1, 1);
+    
+    mainLayout->addWidget(modelLabel, 13, 2, 1, 1);
+    mainLayout->addWidget(modelStatusLabel, 14, 2, 1, 1);
+    mainLayout->addWidget(loadModelButton, 15, 2, 1, 1);
+    mainLayout->addWidget(rollbackButton, 16, 2, 1, 1);
 
     mainLayout->setColumnStretch(0,10);
     mainLayout->setColumnStretch(2,5);
     
 }
 
+/**
+ * @brief Recomputes compliance from every face counted this session at the current sensitivity and shows it
+ */
+static void updateCompliance(){
+    
+    long withMask;
+    long withoutMask;
+    ProbabilityStore *probabilityStore = MaskDetector::getInstance()->getProbabilityStore();
+    probabilityStore->count(MaskDetector::getInstance()->getMaskSensitivity(), withMask, withoutMask);
+    
+    // this value helps us estimate the compliance of the class
+    // add a bias towards compliance to prevent non-compliance from rapidly running down the score
+    float maskCount = (float)withMask;
+    float noMaskCount = (float)withoutMask;
+    compliancePercent = probabilityStore->getTotal() > 0 ? (maskCount*3) / (noMaskCount+(maskCount*3)) : 0.0;
+    
+    float value = 0.0;
+    value = std::ceil(compliancePercent * 10000.0) / 100.0;
+
+    QString complianceText = QString("%1%").arg(value);
+    
+    compliancePercentLabel->setText(QString(complianceText));
+    
+    if(compliancePercent > 0.75){
+        compliancePercentLabel->setStyleSheet("font-weight: bold; color: green; font-size: 20px; text-align: center;");
+    }else{
+        compliancePercentLabel->setStyleSheet("font-weight: bold; color: red; font-size: 20px; text-align: center;");
+    }
+    
+}
+
+/**
+ * @brief Draws the boxes and mask status of the current frame's faces onto an image of it
+ *
+ * @param canvas Image the view renders to
+ * @param view How the camera frame maps onto the canvas
+ */
+static void drawFaces(Mat &canvas, const ViewTransform &view){
+    
+    auto font = FONT_HERSHEY_SIMPLEX;
+    // keep the text the same size relative to the faces at any zoom
+    double fontScale = 1.0 * view.getScale();
+    
+    for (size_t index = 0; index < faceBatch.size(); index++)
+    {
+        Rect display = view.mapRect(faceBatch.getDisplayArea(index));
+        FaceState state = faceBatch.getState(index);
+        
+        if(!faceBatch.isCounted(index)){
+            const char *pendingText = state == FACE_QUEUED ? "Queued" : state == FACE_LOW_QUALITY ? "Low quality" : "Model loading";
+            Scalar pendingColor = Scalar(160, 160, 160);
+            rectangle(canvas, display.tl(), display.br(), pendingColor);
+            putText(canvas, pendingText, display.br(), font, fontScale, pendingColor);
+            continue;
+        }
+
+        Scalar drawColor = Scalar(255, 0, 0);
+
+        // text that will be added to screen
+        string text = "";
+        int percent = (int)(faceBatch.getProbability(index) * 100);
+        
+        // if they are wear/not wearing a mask we display different statuses
+        if(faceBatch.getDecision(index)){
+            drawColor = Scalar(0, 255, 0);
+            text = format("Mask - %d %%", percent);
+        }else{
+            drawColor = Scalar(0, 0, 255);
+            text = format("No Mask - %d %%", (100 - percent));
+        }
+
+        // add face rectangle
+        rectangle(canvas, display.tl(), display.br(), drawColor);
+
+        // add the text for mask status to the canvas
+        putText(canvas, text, display.br(), font, fontScale, drawColor);
+    }
+    
+}
+
 /**
  * @brief Called every time the paint event is fired, we are triggering it every 20ms to ensure the camera view is updated on the UI
  */
@@ -189,16 +306,36 @@ void QWidget::paintEvent(QPaintEvent*) {
         
     if(!paused){
     
+        Startup *startup = Startup::getInstance();
+        
+        // nothing to show until the camera is open
+        if(!startup->isCameraReady()){
+            return;
+        }
+    
         // get the frame data
         Mat frame_in;
-        cap >> frame_in;
+        startup->getCamera() >> frame_in;
+        
+        if(frame_in.empty()){
+            return;
+        }
+        
+        if(startup->getFirstFrameMs() < 0){
+            startup->markFirstFrame();
+        }
+        
+        bool modelReady = MaskDetector::getInstance()->isModelReady();
 
-        // flip the video frame so it feels more natural
-        Mat frame;
-        flip(frame_in, frame, 1);
+        // the analysis works on the frame as the camera delivers it, mirroring and zoom only happen in the final display image
+        const Mat &frame = frame_in;
         
         // extract the current faces that exist on frame
-        vector<Rect> faces = FaceDetector().getInstance()->getFaces(frame);
+        // the feed is shown without boxes while the cascade is still loading
+        vector<Rect> faces;
+        if(startup->isFaceDetectorReady()){
+            faces = FaceDetector::getInstance()->getFaces(frame);
+        }
         
         // count faces and add them to the max people
         if((int)faces.size() > maxPeople){
@@ -210,103 +347,191 @@ void QWidget::paintEvent(QPaintEvent*) {
         Mat resized;
         cv::resize(frame, resized, Size(frame.cols/RESIZE_SCALE, frame.rows/RESIZE_SCALE));
 
-        // iterate through the faces we have
-        for (Rect area : faces)
-        {
-            
-            // setup the face to do heavy lifting behind the scenes
-            Face* currentFace = new Face(resized.clone(), area);
+        // every stage below reads and writes this frame's faces in the same reused batch
+        faceBatch.reset(faces, RESIZE_SCALE);
 
-            // get the mask status from the face object
-            bool hasMask = currentFace->detectMask();
+        // follow faces between frames so a blurred frame can reuse the last good result
+        FaceTracker *tracker = FaceTracker::getInstance();
+        tracker->update(faceBatch.getAreas(), faceBatch.getTracks());
 
-            Scalar drawColor = Scalar(255, 0, 0);
+        // score the faces that need it most first, the ones that do not fit the frame budget carry over their results
+        MaskDetector *detector = MaskDetector::getInstance();
+        InferenceScheduler *scheduler = InferenceScheduler::getInstance();
+        scheduler->rank(faceBatch.getAreas(), faceBatch.getTracks(), tracker, detector->getMaskSensitivity(), faceBatch.getOrder());
 
-            // text that will be added to screen
-            string text = "";
-            
-            // if they are wear/not wearing a mask we display different statuses
-            if(hasMask){
-                drawColor = Scalar(0, 255, 0);
-                string textString = format("Mask - %d %%", currentFace->getProbabilityOfMask());
-                text = textString.c_str();
-                maskCount += 1.0;
-            }else{
-                drawColor = Scalar(0, 0, 255);
-                string textString = format("No Mask - %d %%", (100 - currentFace->getProbabilityOfMask()));
-                text = textString.c_str();
-                noMaskCount += 1.0;
+        // until the model is warmed up we can only show where the faces are
+        for (size_t index : faceBatch.getOrder())
+        {
+            if(!modelReady){
+                continue;
             }
+            
+            int track = faceBatch.getTrack(index);
+            
+            // a view into the small frame, the detector resizes it to the model's input
+            Mat crop = resized(faceBatch.getArea(index) & Rect(0, 0, resized.cols, resized.rows));
 
-            // add face rectangle
-            rectangle(frame, currentFace->getTopLeftPoint(), currentFace->getBottomRightPoint(), drawColor);
+            // only crops worth judging go to the model, the rest keep their track's result or wait for a better frame
+            bool usable = FaceQuality::assess(crop).usable;
+            if(!usable){
+                lowQualityCount++;
+            }
+            
+            if(usable && scheduler->canScore()){
+                MaskResult result = detector->classify(crop);
+                scheduler->recordScore(result.latencyMs);
+                tracker->setResult(track, result);
+                lastResult = result;
+                faceBatch.setResult(index, result.probability, result.hasMask, FACE_SCORED);
+                continue;
+            }
+            
+            if(usable){
+                scheduler->defer();
+            }
+            
+            if(!tracker->hasResult(track)){
+                // not counted towards compliance, a guess from a blurred crop is noise
+                faceBatch.setState(index, usable ? FACE_QUEUED : FACE_LOW_QUALITY);
+                continue;
+            }
+            
+            // decided again in case the sensitivity changed since the result was stored
+            float probability = tracker->getResult(track).probability;
+            faceBatch.setResult(index, probability, probability > detector->getMaskSensitivity(), FACE_CARRIED);
+        }
 
-            // add text for mask status
-            Point coordinates = currentFace->getBottomRightPoint();
-            auto font = FONT_HERSHEY_SIMPLEX;
-            double fontScale = 1.0;
+        // count the faces with a result towards compliance
+        for (size_t index = 0; index < faceBatch.size(); index++)
+        {
+            if(!faceBatch.isCounted(index)){
+                continue;
+            }
             
-            // add the text object to the frame
-            putText(frame, text, coordinates, font, fontScale, drawColor);
+            if(startup->getFirstResultMs() < 0){
+                startup->markFirstResult();
+            }
 
+            // the one record of counted faces, compliance and the histogram are both read from it
+            detector->getProbabilityStore()->add(faceBatch.getProbability(index));
         }
         
-        // record the frame in our video file if recording
+        // record the frame in our video file if recording, the only place the full frame is mirrored
         if(recording){
-            video.write(frame);
-            circle(frame, Point(40,40), 15, Scalar(0,0,255), FILLED);
+            flip(frame, recordFrame, 1);
+            drawFaces(recordFrame, ViewTransform(frame.size(), true, 0, frame.size()));
+            video.write(recordFrame);
         }
         
-        // use a crop ratio to ensure the image doesn't scale awkwardly when zoomiinig
-        const float cropRatio = (float)frame.size().height/(float)frame.size().width;
-        
-        // compute the height/width of the new frame after cropping
-        const int cropHeight = frame.size().height-((int)((float)zoomValue*cropRatio));
-        const int cropWidth = frame.size().width-(zoomValue);
-        
-        const int offsetW = (frame.cols - cropWidth) / 2;
-        const int offsetH = (frame.rows - cropHeight) / 2;
-        const Rect roi(offsetW, offsetH, cropWidth, cropHeight);
-        frame = frame(roi).clone();
-        
         // factor to scale down to fit the image on screen
         const float scaleDown = 0.8;
         
-        // scale down the resolution to fit more appropriately
-        cv::resize(frame, frame, Size(1280*scaleDown, 720*scaleDown), 0, 0, INTER_CUBIC);
+        // mirror so it feels more natural, zoom, and scale down the resolution to fit more appropriately, all in one pass
+        ViewTransform view(frame.size(), true, zoomValue, Size(1280*scaleDown, 720*scaleDown));
+        view.render(frame, displayFrame);
+        drawFaces(displayFrame, view);
+        
+        if(recording){
+            circle(displayFrame, Point(40,40), 15, Scalar(0,0,255), FILLED);
+        }
 
         // Since OpenCV uses BGR order, we need to convert it to RGB
         // NOTE: OpenCV 2.x uses CV_BGR2RGB, OpenCV 3.x uses cv::COLOR_BGR2RGB
-        cv::cvtColor(frame, frame, cv::COLOR_BGR2RGB);
+        cv::cvtColor(displayFrame, displayFrame, cv::COLOR_BGR2RGB);
+
+        // keep the model status current, including versions loading in the background
+        MaskDetector *maskDetector = MaskDetector::getInstance();
+        string modelError = maskDetector->getModelError();
+        QString modelStatus;
+        
+        if(!modelReady){
+            modelStatus = modelError.empty() ? QString("Model loading...") : QString("Model failed to load: %1").arg(modelError.c_str());
+        }else{
+            modelStatus = QString("Using %1 on %2").arg(maskDetector->getModelLocation().c_str()).arg(maskDetector->getModelBackend().c_str());
+            
+            if(maskDetector->isModelLoading()){
+                modelStatus += "\nLoading new version...";
+            }else if(!modelError.empty()){
+                modelStatus += QString("\nNew version failed to load: %1").arg(modelError.c_str());
+            }
+            
+            if(startup->getFirstResultMs() < 0){
+                modelStatus += "\nWaiting for a face";
+            }else{
+                modelStatus += QString("\nFirst frame %1 ms, first result %2 ms").arg(startup->getFirstFrameMs(), 0, 'f', 0).arg(startup->getFirstResultMs(), 0, 'f', 0);
+            }
+            
+            if(!lastResult.backend.empty()){
+                modelStatus += QString("\nLast face %1 ms from %2").arg(lastResult.latencyMs, 0, 'f', 1).arg(lastResult.backend.c_str());
+            }
+            
+            if(scheduler->getDeferredCount() > 0){
+                modelStatus += QString("\nDeferred %1 faces to fit the %2 ms frame budget").arg(scheduler->getDeferredCount()).arg(scheduler->getBudgetMs(), 0, 'f', 0);
+            }
+            
+            if(lowQualityCount > 0){
+                modelStatus += QString("\nLow quality crops kept from the model: %1").arg(lowQualityCount);
+            }
+            
+            ProbabilityCache *cache = maskDetector->getProbabilityCache();
+            if(cache->isEnabled()){
+                modelStatus += QString("\nCache hit rate %1% over %2 faces, tolerance %3 bits, verified error %4")
+                    .arg(100.0 * cache->getHitRate(), 0, 'f', 1).arg(cache->getSize()).arg(cache->getTolerance()).arg(cache->getMeanError(), 0, 'f', 3);
+            }
+            
+            if(maskDetector->isCascadeEnabled()){
+                modelStatus += QString("\nFirst stage sent %1% of faces to the model").arg(100.0 * maskDetector->getEscalationRate(), 0, 'f', 1);
+            }
+        }
+        
+        modelStatusLabel->setText(modelStatus);
 
-        QImage image = QImage((const unsigned char*)frame.data,frame.cols,
-                       frame.rows,frame.step,QImage::Format_RGB888);
+        QImage image = QImage((const unsigned char*)displayFrame.data,displayFrame.cols,
+                       displayFrame.rows,displayFrame.step,QImage::Format_RGB888);
 
         QPainter painter(this);
         
         // display our image inside a label
         imageFeed->setPixmap(QPixmap::fromImage(image));
         
-        // this value helps us estimate the compliance of the class
-        // add a bias towards compliance to prevent non-compliance from rapidly running down the score
-        compliancePercent = (maskCount*3) / (noMaskCount+(maskCount*3));
+        updateCompliance();
+        histogramWidget->update();
         
-        float value = 0.0;
-        value = std::ceil(compliancePercent * 10000.0) / 100.0;
-
-        QString complianceText = QString("%1%").arg(value);
+    }
+    
+}
+/**
+ * @brief Polled while startup is running, finishes the camera setup once it is open and attaches the startup report to the model status when every step is done
+ */
+void MainWindow::startupProgress(){
+    
+    Startup *startup = Startup::getInstance();
+    
+    if(!cameraChecked && startup->isCameraReady()){
         
-        compliancePercentLabel->setText(QString(complianceText));
+        cameraChecked = true;
         
-        if(compliancePercent > 0.75){
-            compliancePercentLabel->setStyleSheet("font-weight: bold; color: green; font-size: 20px; text-align: center;");
-        }else{
-            compliancePercentLabel->setStyleSheet("font-weight: bold; color: red; font-size: 20px; text-align: center;");
+        // check if the video feed is initialized
+        if(!startup->getCamera().isOpened()){
+            QMessageBox::critical(
+                this,
+                tr("Big Brother"),
+                tr("Could not initialize camera, please check to see if your camera is installed properly."));
         }
         
+        // allow up to a 8x zoom based on height
+        int zoomX = startup->getFirstFrame().size().height;
+        zoomSlider->setMaximum(zoomX);
+    }
+    
+    if(startup->isComplete()){
+        startupTimer->stop();
+        // the per-step breakdown, the totals are already in the status text
+        modelStatusLabel->setToolTip(QString::fromStdString(startup->getReport()));
     }
     
 }
+
 /**
  * @brief Called when the pause button is clicked
  */
@@ -355,6 +580,11 @@ void MainWindow::pauseClicked(){
  * @brief Called when the record button is pressed
  */
 void MainWindow::recordClicked(){
+    
+    // there is nothing to record until the camera is open
+    if(!recording && !Startup::getInstance()->isCameraReady()){
+        return;
+    }
         
     if(!recording){
         // change the text
@@ -376,7 +606,7 @@ void MainWindow::recordClicked(){
 
         MainWindow::outputLocation = format("%s/Mask_Recording_%s.avi", OUTPUT_FOLDER, dateTime.c_str());
         
-        cap >> initialFrame;
+        Startup::getInstance()->getCamera() >> initialFrame;
                 
         video.open(outputLocation.c_str(), cv::VideoWriter::fourcc('a','v','c','1'), 10, Size(initialFrame.size().width,initialFrame.size().height));
         
@@ -415,6 +645,10 @@ void MainWindow::sensitivityChanged(double value){
     
     // set the sensitivity in our maskdetector class
     MaskDetector::getInstance()->setMaskSensitivity(value);
+    
+    // recount every face seen so far against the new sensitivity, even while paused
+    updateCompliance();
+    histogramWidget->setSensitivity(value);
         
 }
 
@@ -424,6 +658,8 @@ void MainWindow::sensitivityChanged(double value){
 void MainWindow::exportClicked(){
     
     Report *r = new Report(maxPeople, compliancePercent);
+    r->setHistogram(MaskDetector::getInstance()->getProbabilityStore(), MaskDetector::getInstance()->getMaskSensitivity());
+    r->setStartupTimings(Startup::getInstance()->getReportRows());
     
     r->exportFile();
     
@@ -436,3 +672,68 @@ void MainWindow::exportClicked(){
         tr(message.c_str()));
     
 }
+
+/**
+ * @brief Called when the load model button is clicked, the chosen version loads in the background and replaces the running one once it is warmed up
+ */
+void MainWindow::loadModelClicked(){
+    
+    QString location = QFileDialog::getOpenFileName(
+        this,
+        tr("Load Mask Model"),
+        QString(),
+        tr("Mask models (saved_model.pb *.pb *.tflite *.onnx)"));
+    
+    if(location.isEmpty()){
+        return;
+    }
+    
+    // a SavedModel is loaded from its folder, frozen graphs, .tflite and .onnx files directly
+    QFileInfo file(location);
+    if(file.fileName() == "saved_model.pb"){
+        location = file.absolutePath();
+    }
+    
+    MaskDetector *maskDetector = MaskDetector::getInstance();
+    
+    // the button is disabled while loading, but a load may have started since the dialog opened
+    if(maskDetector->isModelLoading()){
+        QMessageBox::information(
+            this,
+            tr("Big Brother"),
+            tr("Another model version is still loading, please try again once it is done."));
+        return;
+    }
+    
+    maskDetector->loadModel(location.toStdString());
+    
+    loadModelButton->setEnabled(false);
+    modelLoadTimer->start();
+    
+}
+
+/**
+ * @brief Polled while a model version loads in the background, the load model button comes back once it is done. Whether it failed is shown in the model status
+ */
+void MainWindow::modelLoadProgress(){
+    
+    if(!MaskDetector::getInstance()->isModelLoading()){
+        modelLoadTimer->stop();
+        loadModelButton->setEnabled(true);
+    }
+    
+}
+
+/**
+ * @brief Called when the rollback button is clicked
+ */
+void MainWindow::rollbackClicked(){
+    
+    if(!MaskDetector::getInstance()->rollbackModel()){
+        QMessageBox::information(
+            this,
+            tr("Big Brother"),
+            tr("There is no earlier model version to roll back to."));
+    }
+    
+}
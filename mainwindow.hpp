@@ -22,13 +22,24 @@
 #include <QMessageBox>
 #include <QSlider>
 #include <QDoubleSpinBox>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QHBoxLayout>
 #include <time.h>
 
 #include "opencv.hpp"
 #include "environment.hpp"
-#include "Face.hpp"
+#include "MaskDetector.hpp"
+#include "FaceBatch.hpp"
+#include "FaceQuality.hpp"
+#include "HistogramWidget.hpp"
 #include "FaceDetector.hpp"
+#include "FaceTracker.hpp"
+#include "InferenceScheduler.hpp"
+#include "ProbabilityStore.hpp"
 #include "Report.hpp"
+#include "Startup.hpp"
+#include "ViewTransform.hpp"
 
 namespace Ui {
     class MainWindow;
@@ -45,6 +56,8 @@ private slots:
     void pauseClicked();
     void recordClicked();
     void exportClicked();
+    void loadModelClicked();
+    void rollbackClicked();
 
     // zoom slider changed
     void sliderChanged(int value);
@@ -52,9 +65,18 @@ private slots:
     // sensitivity updated
     void sensitivityChanged(double value);
 
+    // background initialization progress
+    void startupProgress();
+
+    // re-enables model loading once the background load finishes
+    void modelLoadProgress();
+
 private:
     // utilities
     QTimer *timer;
+    QTimer *startupTimer;
+    QTimer *modelLoadTimer;
+    bool cameraChecked;
     QGridLayout *mainLayout;
 
     // labels
@@ -62,6 +84,7 @@ private:
     QLabel *statisticsLabel;
     QLabel *complianceLabel;
     QLabel *peopleLabel;
+    QLabel *modelLabel;
 
     QLabel *controlsLabel;
     QLabel *zoomLabel;
@@ -70,6 +93,8 @@ private:
     QPushButton *pauseButton;
     QPushButton *recordButton;
     QPushButton *exportButton;
+    QPushButton *loadModelButton;
+    QPushButton *rollbackButton;
 
     QSlider *zoomSlider;
     QDoubleSpinBox *sensitivityInput;
@@ -0,0 +1,974 @@
+/**
+ * @file bbtool.cpp
+ * @brief Command line helpers used when preparing an install, run without arguments to list the commands
+ * @bug no known bugs
+ */
+
+/** -- Includes -- **/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "environment.hpp"
+#include "CascadeCache.hpp"
+#include "FaceQuality.hpp"
+#include "FaceBatch.hpp"
+#include "FaceTracker.hpp"
+#include "InferenceScheduler.hpp"
+#include "LowerFaceClassifier.hpp"
+#include "MaskDetector.hpp"
+#include "TensorFlowBackend.hpp"
+
+using namespace std;
+
+// every operator new in the process goes through here, so input-allocations can count heap allocations per call
+static std::atomic<long> heapAllocations(0);
+
+void *operator new(size_t size){
+
+    heapAllocations++;
+
+    void *memory = malloc(size ? size : 1);
+    if(!memory){
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void *memory) noexcept{
+    free(memory);
+}
+
+/**
+ * @brief Prints the available commands
+ */
+static int usage(){
+
+    cerr << "usage: bbtool <command> [args]" << endl;
+    cerr << endl;
+    cerr << "  cascade-cache [xml] [cache]   build the binary face cascade cache" << endl;
+    cerr << "  model-load <model> [runs]     time loading a SavedModel folder or frozen .pb" << endl;
+    cerr << "  signature <model>             list the serving inputs and outputs the app will bind to" << endl;
+    cerr << "  input-allocations [rounds]    check steady state inference creates no input slots, and count its heap allocations" << endl;
+    cerr << "  profile <runs> <every> <batch> [trace.json]" << endl;
+    cerr << "                                per-op time and memory of the mask model, optionally as a Chrome trace" << endl;
+    cerr << "  session-bench <model> <sessions> <intra> [callers] [requests] [batch]" << endl;
+    cerr << "                                throughput and latency of concurrent callers spread over the sessions" << endl;
+    cerr << "  session-bench <model> sweep [callers] [requests] [batch]" << endl;
+    cerr << "                                the above for 1, 2, 4... sessions splitting the cores between them" << endl;
+    cerr << "  backend-bench <faces|-> <model[@backend]>..." << endl;
+    cerr << "                                load time, latency, memory and accuracy of each model on its backend," << endl;
+    cerr << "                                faces is a folder with mask/ and no_mask/ crops, - skips accuracy" << endl;
+    cerr << "  parity <faces|-> <tolerance> <reference[@backend]> <model[@backend]>..." << endl;
+    cerr << "                                fail if any model's probabilities differ from the reference by more than tolerance," << endl;
+    cerr << "                                faces is a folder of crops, - uses random faces" << endl;
+    cerr << "  cache-bench <crops> [tolerance]..." << endl;
+    cerr << "                                hit rate and error of the probability cache at each tolerance against uncached runs," << endl;
+    cerr << "                                crops is a folder of consecutive face crops, e.g. saved from a recording" << endl;
+    cerr << "  frame-budget <faces> <people> [frames]" << endl;
+    cerr << "                                frame latency and deferred faces of the scheduler with that many people in view," << endl;
+    cerr << "                                faces is a folder of crops handed out to the people in turn" << endl;
+    cerr << "  face-quality <folder>         sharpness, brightness and size of each crop and whether it passes the quality gate" << endl;
+    cerr << "  cascade-bench <faces> [band]..." << endl;
+    cerr << "                                escalation rate, throughput and accuracy of the first stage at each uncertainty band," << endl;
+    cerr << "                                fails if a face the first stage cannot judge does not get the model's answer," << endl;
+    cerr << "                                faces is a folder with mask/ and no_mask/ crops" << endl;
+    cerr << endl;
+    cerr << "commands that run the mask model use BIGBROTHER_MASK_MODEL or MASK_MODEL_LOCATION" << endl;
+
+    return 1;
+}
+
+/**
+ * @brief Builds the face cascade cache so the first kiosk start does not have to
+ */
+static int cascadeCache(const vector<string> &args){
+
+    string xmlLocation = args.size() > 0 ? args[0] : FACE_MODEL_LOCATION;
+    string cacheLocation = args.size() > 1 ? args[1] : FACE_CACHE_LOCATION;
+
+    if(!CascadeCache::build(xmlLocation, cacheLocation)){
+        cerr << "could not build " << cacheLocation << " from " << xmlLocation << endl;
+        return 1;
+    }
+
+    cout << "wrote " << cacheLocation << endl;
+
+    return 0;
+}
+
+/**
+ * @brief Peak resident memory of this process in megabytes
+ */
+static double peakMemoryMb(){
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+}
+
+/**
+ * @brief Times loading a model and its first inference, run once per format to compare a SavedModel with its frozen graph
+ */
+static int modelLoad(const vector<string> &args){
+
+    if(args.empty()){
+        return usage();
+    }
+
+    string location = args[0];
+    int runs = args.size() > 1 ? stoi(args[1]) : 5;
+
+    bool frozen = TensorFlowBackend::isFrozenGraph(location);
+
+    std::vector<float> blank(IMG_SIZE * IMG_SIZE * 3, 0.f);
+    auto input = cppflow::tensor(blank, {1, IMG_SIZE, IMG_SIZE, 3});
+
+    double loadTotal = 0.0;
+    double firstRunTotal = 0.0;
+
+    for(int i = 0; i < runs; i++){
+
+        auto start = std::chrono::steady_clock::now();
+        cppflow::model model(location, frozen ? cppflow::model::FROZEN_GRAPH : cppflow::model::SAVED_MODEL);
+        auto loaded = std::chrono::steady_clock::now();
+        model(input);
+        auto ran = std::chrono::steady_clock::now();
+
+        loadTotal += std::chrono::duration<double, std::milli>(loaded - start).count();
+        firstRunTotal += std::chrono::duration<double, std::milli>(ran - loaded).count();
+    }
+
+    cout << (frozen ? "frozen graph " : "saved model  ") << location << endl;
+    cout << format("  load        %8.1f ms", loadTotal / runs) << endl;
+    cout << format("  first run   %8.1f ms", firstRunTotal / runs) << endl;
+    cout << format("  peak memory %8.1f MB", peakMemoryMb()) << endl;
+
+    return 0;
+}
+
+/**
+ * @brief Prints every signature of a model with the graph tensor, type and shape behind each input and output
+ */
+static int showSignature(const vector<string> &args){
+
+    if(args.empty()){
+        return usage();
+    }
+
+    string location = args[0];
+    bool frozen = TensorFlowBackend::isFrozenGraph(location);
+    cppflow::model model(location, frozen ? cppflow::model::FROZEN_GRAPH : cppflow::model::SAVED_MODEL);
+
+    auto describe = [](const char *side, const cppflow::signature_tensor &t){
+        string shape;
+        for(int64_t dim : t.shape){
+            shape += (shape.empty() ? "" : ",") + (dim < 0 ? string("?") : std::to_string(dim));
+        }
+        cout << "  " << side << " " << t.key << " -> " << t.name << " " << cppflow::to_string(t.dtype) << " [" << shape << "]" << endl;
+    };
+
+    for(const string &name : model.get_signature_names()){
+        const cppflow::signature &sig = model.get_signature(name);
+        cout << name << " (" << sig.method_name << ")" << endl;
+        for(const auto &t : sig.inputs){
+            describe("input ", t);
+        }
+        for(const auto &t : sig.outputs){
+            describe("output", t);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Runs every batch size once to fill the input pool, then keeps running and checks no more input slots are created
+ *
+ * The heap allocations made by the whole call are counted as well, these include the outputs and the runtime's own bookkeeping, so they are reported but only the input slot count has to stay flat
+ */
+static int inputAllocations(const vector<string> &args){
+
+    int rounds = args.size() > 0 ? stoi(args[0]) : 10;
+
+    MaskDetector *detector = MaskDetector::getInstance();
+    detector->waitForModel();
+
+    // the same face over and over would otherwise be answered by the cache or the first stage without reaching the model
+    detector->getProbabilityCache()->setCapacity(0);
+    detector->setCascade(false, 0.f);
+
+    Mat face(IMG_SIZE, IMG_SIZE, CV_8UC3, Scalar(90, 120, 160));
+
+    // built up front so only the calls themselves are counted
+    vector<vector<Mat>> batches;
+    for(int faces = 1; faces <= MAX_BATCH_SIZE; faces++){
+        batches.push_back(vector<Mat>(faces, face));
+    }
+
+    for(auto &batch : batches){
+        detector->maskProbabilities(batch);
+    }
+
+    long warmedUp = detector->getInputSlots();
+    long heapBefore = heapAllocations;
+
+    for(int round = 0; round < rounds; round++){
+        for(auto &batch : batches){
+            detector->maskProbabilities(batch);
+        }
+    }
+
+    long heapCalls = heapAllocations - heapBefore;
+    long steadyState = detector->getInputSlots() - warmedUp;
+    long calls = (long)rounds * batches.size();
+
+    cout << "input slots created while warming up: " << warmedUp << endl;
+    cout << "input slots created in steady state:  " << steadyState << endl;
+    cout << "heap allocations per call in steady state: " << (calls > 0 ? (double)heapCalls / calls : 0.0) << endl;
+
+    return steadyState == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Runs the mask model with per-op tracing and prints where the time goes
+ */
+static int profile(const vector<string> &args){
+
+    int runs = args.size() > 0 ? stoi(args[0]) : 100;
+    int every = args.size() > 1 ? stoi(args[1]) : 10;
+    int batch = args.size() > 2 ? stoi(args[2]) : 1;
+
+    MaskDetector *detector = MaskDetector::getInstance();
+    detector->waitForModel();
+
+    if(every <= 0){
+        cerr << "profile needs every to be at least 1" << endl;
+        return 1;
+    }
+
+    auto profiler = detector->setProfiling(every);
+    if(!profiler){
+        cerr << "profiling needs the TensorFlow backend, the model runs on " << detector->getModelBackend() << endl;
+        return 1;
+    }
+
+    vector<Mat> faces(batch, Mat(IMG_SIZE, IMG_SIZE, CV_8UC3, Scalar(90, 120, 160)));
+    for(int i = 0; i < runs; i++){
+        detector->maskProbabilities(faces);
+    }
+
+    cout << profiler->table();
+
+    if(args.size() > 3){
+        std::ofstream trace(args[3]);
+        trace << profiler->chrome_trace();
+        cout << "wrote " << args[3] << endl;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Latency at a percentile of an already sorted list
+ */
+static double percentile(const vector<double> &sorted, double fraction){
+
+    if(sorted.empty()){
+        return 0.0;
+    }
+
+    size_t index = std::min(sorted.size() - 1, (size_t)(fraction * sorted.size()));
+
+    return sorted[index];
+}
+
+/**
+ * @brief Loads the model with one session layout and has every caller thread send batches as fast as it can
+ */
+static int sessionRun(const string &location, SessionConfig config, int callers, int requests, int batch){
+
+    TensorFlowBackend backend(location, config);
+
+    cppflow::tensor input;
+    if(backend.getInputType() == TF_UINT8){
+        input = cppflow::tensor(std::vector<uint8_t>((size_t)batch * IMG_SIZE * IMG_SIZE * 3, 0), {batch, IMG_SIZE, IMG_SIZE, 3});
+    }else{
+        input = cppflow::tensor(std::vector<float>((size_t)batch * IMG_SIZE * IMG_SIZE * 3, 0.f), {batch, IMG_SIZE, IMG_SIZE, 3});
+    }
+
+    vector<vector<double>> latencies(callers);
+    vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for(int caller = 0; caller < callers; caller++){
+        threads.emplace_back([&, caller](){
+            for(int i = 0; i < requests; i++){
+                auto sent = std::chrono::steady_clock::now();
+                backend.run(input);
+                latencies[caller].push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sent).count());
+            }
+        });
+    }
+    for(auto &thread : threads){
+        thread.join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    vector<double> all;
+    for(const auto &caller : latencies){
+        all.insert(all.end(), caller.begin(), caller.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    cout << format("%8d %6d %6d %8d %12.1f %9.2f %9.2f",
+                   config.sessions, config.intraOpThreads, config.interOpThreads, callers,
+                   (double)callers * requests * batch / seconds, percentile(all, 0.5), percentile(all, 0.99)) << endl;
+
+    return 0;
+}
+
+/**
+ * @brief Compares one shared session against several smaller ones for concurrent small batch inference
+ *
+ * Thread counts give every session its own pools, so the sweep splits the cores between the sessions. Each layout still runs in its own child process so one layout's pools cannot linger into the next
+ */
+static int sessionBench(const vector<string> &args){
+
+    if(args.size() < 2){
+        return usage();
+    }
+
+    string location = args[0];
+    bool sweep = args[1] == "sweep";
+    size_t rest = sweep ? 2 : 3;
+
+    if(!sweep && args.size() < 3){
+        return usage();
+    }
+
+    int cores = std::max(1u, std::thread::hardware_concurrency());
+    int callers = args.size() > rest ? stoi(args[rest]) : cores;
+    int requests = args.size() > rest + 1 ? stoi(args[rest + 1]) : 200;
+    int batch = args.size() > rest + 2 ? stoi(args[rest + 2]) : 1;
+
+    // with no thread counts TensorFlow falls back to pools shared by every session, sized by the first one
+    bool perSession = sweep || stoi(args[2]) > 0;
+    cout << (perSession ? "thread pools: per session, intra and inter are per session" : "thread pools: shared by every session") << endl;
+    cout << format("%8s %6s %6s %8s %12s %9s %9s", "sessions", "intra", "inter", "callers", "faces/s", "p50 ms", "p99 ms") << endl;
+
+    if(!sweep){
+        SessionConfig config;
+        config.sessions = stoi(args[1]);
+        config.intraOpThreads = stoi(args[2]);
+        config.interOpThreads = 0;
+        return sessionRun(location, config, callers, requests, batch);
+    }
+
+    int failed = 0;
+
+    for(int sessions = 1; sessions <= callers; sessions *= 2){
+
+        SessionConfig config;
+        config.sessions = sessions;
+        config.intraOpThreads = std::max(1, cores / sessions);
+        config.interOpThreads = sessions == 1 ? 0 : 1;
+
+        cout.flush();
+        pid_t child = fork();
+        if(child == 0){
+            _exit(sessionRun(location, config, callers, requests, batch));
+        }
+
+        int status = 0;
+        waitpid(child, &status, 0);
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            failed++;
+        }
+    }
+
+    return failed == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Reads every image in a folder
+ */
+static vector<Mat> readFaces(const string &folder){
+
+    vector<String> files;
+    glob(folder, files);
+
+    vector<Mat> faces;
+    for(const String &file : files){
+        Mat face = imread(file, IMREAD_COLOR);
+        if(!face.empty()){
+            faces.push_back(face);
+        }
+    }
+
+    return faces;
+}
+
+/**
+ * @brief Splits model@backend, the backend defaults to auto
+ */
+static std::shared_ptr<MaskBackend> loadSpec(const string &spec){
+
+    size_t at = spec.rfind('@');
+    string location = at == string::npos ? spec : spec.substr(0, at);
+    string backendName = at == string::npos ? "auto" : spec.substr(at + 1);
+
+    return MaskBackend::load(location, backendName, SessionConfig::fromEnvironment());
+}
+
+/**
+ * @brief Loads one model on one backend and measures it, run in its own process so the peak memory is its own
+ */
+static int backendRun(const string &spec, const vector<Mat> &masked, const vector<Mat> &unmasked, float threshold){
+
+    auto loadStart = std::chrono::steady_clock::now();
+    auto backend = loadSpec(spec);
+    double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+
+    // single faces, the common case on a kiosk
+    Mat face(IMG_SIZE, IMG_SIZE, CV_8UC3, Scalar(90, 120, 160));
+    float probability;
+    vector<double> latencies;
+    for(int i = 0; i < 200; i++){
+        auto sent = std::chrono::steady_clock::now();
+        backend->run(&face, 1, &probability);
+        latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sent).count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    // full batches, for crowded frames
+    vector<Mat> batch(MAX_BATCH_SIZE, face);
+    vector<float> probabilities(MAX_BATCH_SIZE);
+    auto batchStart = std::chrono::steady_clock::now();
+    for(int i = 0; i < 20; i++){
+        backend->run(batch.data(), MAX_BATCH_SIZE, probabilities.data());
+    }
+    double facesPerSecond = 20.0 * MAX_BATCH_SIZE / std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+    string accuracy = "-";
+    if(!masked.empty() || !unmasked.empty()){
+        int correct = 0;
+        for(const Mat &crop : masked){
+            backend->run(&crop, 1, &probability);
+            correct += probability > threshold;
+        }
+        for(const Mat &crop : unmasked){
+            backend->run(&crop, 1, &probability);
+            correct += probability <= threshold;
+        }
+        accuracy = format("%.2f%%", 100.0 * correct / (masked.size() + unmasked.size()));
+    }
+
+    cout << format("%-10s %9.1f %8.2f %8.2f %10.1f %9.1f %9s  ", backend->getName().c_str(), loadMs,
+                   percentile(latencies, 0.5), percentile(latencies, 0.99), facesPerSecond, peakMemoryMb(), accuracy.c_str())
+         << backend->getLocation() << endl;
+
+    return 0;
+}
+
+/**
+ * @brief Compares models across backends, e.g. the SavedModel on TensorFlow against its int8 .tflite export
+ */
+static int backendBench(const vector<string> &args){
+
+    if(args.size() < 2){
+        return usage();
+    }
+
+    vector<Mat> masked;
+    vector<Mat> unmasked;
+    if(args[0] != "-"){
+        masked = readFaces(args[0] + "/mask");
+        unmasked = readFaces(args[0] + "/no_mask");
+    }
+
+    // the sensitivity the app starts with
+    float threshold = MaskDetector().getMaskSensitivity();
+
+    cout << "available backends:";
+    for(const string &name : MaskBackend::getAvailableBackends()){
+        cout << " " << name;
+    }
+    cout << endl;
+    cout << format("%-10s %9s %8s %8s %10s %9s %9s  %s", "backend", "load ms", "p50 ms", "p99 ms", "faces/s", "peak MB", "accuracy", "model") << endl;
+
+    int failed = 0;
+
+    for(size_t i = 1; i < args.size(); i++){
+
+        cout.flush();
+        pid_t child = fork();
+        if(child == 0){
+            try {
+                _exit(backendRun(args[i], masked, unmasked, threshold));
+            } catch (const std::exception &e) {
+                cerr << args[i] << ": " << e.what() << endl;
+                _exit(1);
+            }
+        }
+
+        int status = 0;
+        waitpid(child, &status, 0);
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            failed++;
+        }
+    }
+
+    return failed == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Checks exports of the model agree with the reference, e.g. an ONNX or frozen graph on OpenCV against the SavedModel on TensorFlow
+ */
+static int parity(const vector<string> &args){
+
+    if(args.size() < 4){
+        return usage();
+    }
+
+    float tolerance = stof(args[1]);
+
+    vector<Mat> faces;
+    if(args[0] != "-"){
+        faces = readFaces(args[0]);
+        vector<Mat> masked = readFaces(args[0] + "/mask");
+        vector<Mat> unmasked = readFaces(args[0] + "/no_mask");
+        faces.insert(faces.end(), masked.begin(), masked.end());
+        faces.insert(faces.end(), unmasked.begin(), unmasked.end());
+    }else{
+        // the same random faces every run
+        RNG rng(3307);
+        for(int i = 0; i < 64; i++){
+            Mat face(IMG_SIZE, IMG_SIZE, CV_8UC3);
+            rng.fill(face, RNG::UNIFORM, 0, 256);
+            faces.push_back(face);
+        }
+    }
+
+    if(faces.empty()){
+        cerr << "no faces in " << args[0] << endl;
+        return 1;
+    }
+
+    // batches of mixed sizes so padding rows are exercised too
+    auto probabilities = [&faces](MaskBackend &backend){
+        vector<float> result(faces.size());
+        for(size_t start = 0; start < faces.size();){
+            int count = (int)std::min(faces.size() - start, (size_t)(start % 3 == 0 ? MAX_BATCH_SIZE : 3));
+            backend.run(faces.data() + start, count, result.data() + start);
+            start += count;
+        }
+        return result;
+    };
+
+    auto reference = loadSpec(args[2]);
+    vector<float> expected = probabilities(*reference);
+
+    cout << "reference " << reference->getName() << " " << reference->getLocation() << ", " << faces.size() << " faces" << endl;
+    cout << format("%-10s %10s %10s %8s  %s", "backend", "max diff", "mean diff", "result", "model") << endl;
+
+    int failed = 0;
+
+    for(size_t i = 3; i < args.size(); i++){
+
+        auto backend = loadSpec(args[i]);
+        vector<float> actual = probabilities(*backend);
+
+        double maxDiff = 0.0;
+        double totalDiff = 0.0;
+        for(size_t face = 0; face < faces.size(); face++){
+            double diff = std::abs(actual[face] - expected[face]);
+            maxDiff = std::max(maxDiff, diff);
+            totalDiff += diff;
+        }
+
+        bool pass = maxDiff <= tolerance;
+        failed += !pass;
+
+        cout << format("%-10s %10.6f %10.6f %8s  ", backend->getName().c_str(), maxDiff, totalDiff / faces.size(), pass ? "ok" : "FAIL")
+             << backend->getLocation() << endl;
+    }
+
+    return failed == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Scores saved face crops against the quality gate, to tune the FACE_MIN_* thresholds for a camera
+ */
+static int faceQuality(const vector<string> &args){
+
+    if(args.empty()){
+        return usage();
+    }
+
+    vector<String> files;
+    glob(args[0], files);
+
+    cout << format("%10s %10s %6s %7s  %s", "sharpness", "brightness", "size", "usable", "crop") << endl;
+
+    int scored = 0;
+    int usable = 0;
+
+    for(const String &file : files){
+
+        Mat crop = imread(file, IMREAD_COLOR);
+        if(crop.empty()){
+            continue;
+        }
+
+        QualityScore score = FaceQuality::assess(crop);
+        scored++;
+        usable += score.usable;
+
+        cout << format("%10.1f %10.1f %6d %7s  ", score.sharpness, score.brightness, score.size, score.usable ? "yes" : "no") << file << endl;
+    }
+
+    cout << usable << " of " << scored << " crops usable" << endl;
+
+    return 0;
+}
+
+/**
+ * @brief Shows what each uncertainty band costs in accuracy and buys in throughput, against every face going to the model
+ */
+static int cascadeBench(const vector<string> &args){
+
+    if(args.empty()){
+        return usage();
+    }
+
+    vector<Mat> faces = readFaces(args[0] + "/mask");
+    size_t maskedCount = faces.size();
+    vector<Mat> unmasked = readFaces(args[0] + "/no_mask");
+    faces.insert(faces.end(), unmasked.begin(), unmasked.end());
+
+    if(faces.empty()){
+        cerr << "no faces in " << args[0] << "/mask or " << args[0] << "/no_mask" << endl;
+        return 1;
+    }
+
+    // the faces are read at whatever size they were saved, the app hands over IMG_SIZE crops
+    for(Mat &face : faces){
+        resize(face, face, Size(IMG_SIZE, IMG_SIZE));
+    }
+
+    // faces the first stage cannot judge, the ones in the set plus a darkened copy of every face, which hides its skin tone
+    vector<size_t> unknown;
+    vector<Mat> dark(faces.size());
+    int darkUnknown = 0;
+    for(size_t i = 0; i < faces.size(); i++){
+        float score;
+        if(!LowerFaceClassifier::score(faces[i], score)){
+            unknown.push_back(i);
+        }
+        faces[i].convertTo(dark[i], -1, 0.15);
+        darkUnknown += !LowerFaceClassifier::score(dark[i], score);
+    }
+
+    vector<float> bands;
+    for(size_t i = 1; i < args.size(); i++){
+        bands.push_back(stof(args[i]));
+    }
+    if(bands.empty()){
+        bands = {0.05f, 0.1f, 0.15f, 0.25f, 0.5f};
+    }
+
+    MaskDetector *detector = MaskDetector::getInstance();
+    detector->waitForModel();
+    float threshold = detector->getMaskSensitivity();
+
+    // darkened copies hash like the originals, so the cache would hand back the original's answer
+    detector->getProbabilityCache()->setCapacity(0);
+
+    // one face per call like the paint loop, timed over the whole set
+    auto classify = [detector](const vector<Mat> &set, double &facesPerSecond){
+        vector<float> probabilities(set.size());
+        auto start = std::chrono::steady_clock::now();
+        for(size_t i = 0; i < set.size(); i++){
+            probabilities[i] = detector->maskProbability(set[i]);
+        }
+        facesPerSecond = set.size() / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return probabilities;
+    };
+
+    auto accuracy = [&faces, maskedCount, threshold](const vector<float> &probabilities){
+        int correct = 0;
+        for(size_t i = 0; i < faces.size(); i++){
+            correct += (probabilities[i] > threshold) == (i < maskedCount);
+        }
+        return 100.0 * correct / faces.size();
+    };
+
+    double facesPerSecond;
+    double darkFacesPerSecond;
+    detector->setCascade(false, 0.f);
+    vector<float> full = classify(faces, facesPerSecond);
+    vector<float> fullDark = classify(dark, darkFacesPerSecond);
+
+    cout << detector->getModelBackend() << " " << detector->getModelLocation() << ", " << faces.size() << " faces, sensitivity " << threshold << endl;
+    cout << "first stage cannot judge " << unknown.size() << " of the faces and " << darkUnknown << " of their darkened copies, these must match the model" << endl;
+    cout << format("%-8s %10s %10s %9s %9s %9s", "band", "escalated", "faces/s", "accuracy", "agrees", "unknown") << endl;
+    cout << format("%-8s %9.1f%% %10.1f %8.2f%% %8.2f%% %8.2f%%", "off", 100.0, facesPerSecond, accuracy(full), 100.0, 100.0) << endl;
+
+    int failed = 0;
+
+    for(float band : bands){
+
+        detector->setCascade(true, band);
+        detector->resetCascadeStats();
+        vector<float> cascaded = classify(faces, facesPerSecond);
+        float escalationRate = detector->getEscalationRate();
+        vector<float> cascadedDark = classify(dark, darkFacesPerSecond);
+
+        int agree = 0;
+        for(size_t i = 0; i < faces.size(); i++){
+            agree += (cascaded[i] > threshold) == (full[i] > threshold);
+        }
+
+        // every face the first stage cannot judge goes to the model, so it has to get the model's answer at any band
+        int unknownAgree = 0;
+        int unknownTotal = (int)unknown.size() + darkUnknown;
+        for(size_t i : unknown){
+            unknownAgree += (cascaded[i] > threshold) == (full[i] > threshold);
+        }
+        for(size_t i = 0; i < dark.size(); i++){
+            float score;
+            if(!LowerFaceClassifier::score(dark[i], score)){
+                unknownAgree += (cascadedDark[i] > threshold) == (fullDark[i] > threshold);
+            }
+        }
+        failed += unknownAgree != unknownTotal;
+
+        cout << format("%-8.3f %9.1f%% %10.1f %8.2f%% %8.2f%% %8.2f%%", band, 100.0 * escalationRate, facesPerSecond,
+                       accuracy(cascaded), 100.0 * agree / faces.size(), unknownTotal > 0 ? 100.0 * unknownAgree / unknownTotal : 100.0) << endl;
+    }
+
+    return failed == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Replays saved crops through the probability cache at each tolerance and compares the results with the model's
+ */
+static int cacheBench(const vector<string> &args){
+
+    if(args.empty()){
+        return usage();
+    }
+
+    vector<Mat> faces = readFaces(args[0]);
+    if(faces.empty()){
+        cerr << "no faces in " << args[0] << endl;
+        return 1;
+    }
+    for(Mat &face : faces){
+        resize(face, face, Size(IMG_SIZE, IMG_SIZE));
+    }
+
+    vector<int> tolerances;
+    for(size_t i = 1; i < args.size(); i++){
+        tolerances.push_back(stoi(args[i]));
+    }
+    if(tolerances.empty()){
+        tolerances = {0, 2, 4, 6, 8};
+    }
+
+    MaskDetector *detector = MaskDetector::getInstance();
+    detector->waitForModel();
+    float threshold = detector->getMaskSensitivity();
+
+    ProbabilityCache *cache = detector->getProbabilityCache();
+    size_t capacity = cache->isEnabled() ? cache->getCapacity() : 256;
+
+    // in order, one face per call like the paint loop
+    auto classify = [&faces, detector](double &facesPerSecond){
+        vector<float> probabilities(faces.size());
+        auto start = std::chrono::steady_clock::now();
+        for(size_t i = 0; i < faces.size(); i++){
+            probabilities[i] = detector->maskProbability(faces[i]);
+        }
+        facesPerSecond = faces.size() / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return probabilities;
+    };
+
+    double facesPerSecond;
+    cache->setCapacity(0);
+    vector<float> uncached = classify(facesPerSecond);
+
+    cout << faces.size() << " faces, cache of " << capacity << ", sensitivity " << threshold << endl;
+    cout << format("%-9s %8s %10s %10s %10s %9s", "tolerance", "hits", "faces/s", "mean diff", "max diff", "agrees") << endl;
+    cout << format("%-9s %7.1f%% %10.1f %10.6f %10.6f %8.2f%%", "off", 0.0, facesPerSecond, 0.0, 0.0, 100.0) << endl;
+
+    for(int tolerance : tolerances){
+
+        cache->setCapacity(capacity);
+        cache->setTolerance(tolerance);
+        cache->clear();
+        cache->resetStats();
+        vector<float> cached = classify(facesPerSecond);
+
+        double maxDiff = 0.0;
+        double totalDiff = 0.0;
+        int agree = 0;
+        for(size_t i = 0; i < faces.size(); i++){
+            double diff = std::abs(cached[i] - uncached[i]);
+            maxDiff = std::max(maxDiff, diff);
+            totalDiff += diff;
+            agree += (cached[i] > threshold) == (uncached[i] > threshold);
+        }
+
+        cout << format("%-9d %7.1f%% %10.1f %10.6f %10.6f %8.2f%%", tolerance, 100.0 * cache->getHitRate(), facesPerSecond,
+                       totalDiff / faces.size(), maxDiff, 100.0 * agree / faces.size()) << endl;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Runs the paint loop's scheduling over a fixed crowd and shows that frame latency stays within the budget however many people there are
+ */
+static int frameBudget(const vector<string> &args){
+
+    if(args.size() < 2){
+        return usage();
+    }
+
+    vector<Mat> crops = readFaces(args[0]);
+    int people = stoi(args[1]);
+    int frames = args.size() > 2 ? stoi(args[2]) : 200;
+
+    if(crops.empty() || people < 1){
+        cerr << "no faces in " << args[0] << endl;
+        return 1;
+    }
+    for(Mat &crop : crops){
+        resize(crop, crop, Size(IMG_SIZE, IMG_SIZE));
+    }
+
+    // people standing in a grid, far enough apart that no two boxes overlap
+    vector<Rect> faces;
+    for(int i = 0; i < people; i++){
+        faces.push_back(Rect((i % 8) * 40, (i / 8) * 40, 32 + i % 5, 32 + i % 5));
+    }
+
+    MaskDetector *detector = MaskDetector::getInstance();
+    detector->waitForModel();
+
+    FaceTracker tracker;
+    InferenceScheduler *scheduler = InferenceScheduler::getInstance();
+    FaceBatch batch;
+
+    vector<double> latencies;
+    double totalDeferred = 0.0;
+    int oldestResult = 0;
+
+    for(int frame = 0; frame < frames; frame++){
+
+        auto start = std::chrono::steady_clock::now();
+
+        batch.reset(faces, RESIZE_SCALE);
+        tracker.update(batch.getAreas(), batch.getTracks());
+        scheduler->rank(batch.getAreas(), batch.getTracks(), &tracker, detector->getMaskSensitivity(), batch.getOrder());
+
+        for(size_t index : batch.getOrder()){
+            if(scheduler->canScore()){
+                MaskResult result = detector->classify(crops[index % crops.size()]);
+                scheduler->recordScore(result.latencyMs);
+                tracker.setResult(batch.getTrack(index), result);
+                batch.setResult(index, result.probability, result.hasMask, FACE_SCORED);
+            }else{
+                scheduler->defer();
+            }
+        }
+
+        latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        totalDeferred += scheduler->getDeferredCount();
+
+        // skip the first frames while every track is still new
+        if(frame >= frames / 2){
+            for(int track : batch.getTracks()){
+                oldestResult = std::max(oldestResult, tracker.getResultAge(track));
+            }
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    cout << people << " people, " << frames << " frames, budget " << scheduler->getBudgetMs() << " ms, " << format("%.2f", scheduler->getFaceCostMs()) << " ms per face" << endl;
+    cout << format("frame p50 %.2f ms, p99 %.2f ms, max %.2f ms", percentile(latencies, 0.5), percentile(latencies, 0.99), latencies.back()) << endl;
+    cout << format("%.1f faces deferred per frame, oldest result %d frames", totalDeferred / frames, oldestResult) << endl;
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2){
+        return usage();
+    }
+
+    string command = argv[1];
+    vector<string> args(argv + 2, argv + argc);
+
+    if(command == "cascade-cache"){
+        return cascadeCache(args);
+    }
+    if(command == "model-load"){
+        return modelLoad(args);
+    }
+    if(command == "signature"){
+        return showSignature(args);
+    }
+    if(command == "input-allocations"){
+        return inputAllocations(args);
+    }
+    if(command == "profile"){
+        return profile(args);
+    }
+    if(command == "session-bench"){
+        return sessionBench(args);
+    }
+    if(command == "backend-bench"){
+        return backendBench(args);
+    }
+    if(command == "parity"){
+        return parity(args);
+    }
+    if(command == "cache-bench"){
+        return cacheBench(args);
+    }
+    if(command == "frame-budget"){
+        return frameBudget(args);
+    }
+    if(command == "face-quality"){
+        return faceQuality(args);
+    }
+    if(command == "cascade-bench"){
+        return cascadeBench(args);
+    }
+
+    return usage();
+}
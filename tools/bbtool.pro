@@ -0,0 +1,27 @@
+# command line helpers for preparing installs and measuring the pipeline
+TARGET = bbtool
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ..
+
+HEADERS = ../environment.hpp ../opencv.hpp ../CascadeCache.hpp ../MaskDetector.hpp ../ModelRegistry.hpp ../TensorPool.hpp ../MaskBackend.hpp ../TensorFlowBackend.hpp ../OpenCVBackend.hpp ../TFLiteBackend.hpp ../OnnxRuntimeBackend.hpp ../LowerFaceClassifier.hpp ../FaceQuality.hpp ../ProbabilityCache.hpp ../ProbabilityStore.hpp ../FaceTracker.hpp ../InferenceScheduler.hpp ../FaceBatch.hpp
+SOURCES = bbtool.cpp ../CascadeCache.cpp ../MaskDetector.cpp ../ModelRegistry.cpp ../TensorPool.cpp ../MaskBackend.cpp ../TensorFlowBackend.cpp ../OpenCVBackend.cpp ../TFLiteBackend.cpp ../OnnxRuntimeBackend.cpp ../LowerFaceClassifier.cpp ../FaceQuality.cpp ../ProbabilityCache.cpp ../ProbabilityStore.cpp ../FaceTracker.cpp ../InferenceScheduler.cpp ../FaceBatch.cpp
+
+CONFIG += link_pkgconfig
+PKGCONFIG += opencv4 tensorflow
+
+tflite {
+    DEFINES += BIGBROTHER_WITH_TFLITE
+    LIBS += -ltensorflowlite_c
+}
+
+# optional ONNX Runtime backend, build with: qmake CONFIG+=onnxruntime (add CONFIG+=onnxruntime_dnnl for the oneDNN provider)
+onnxruntime {
+    DEFINES += BIGBROTHER_WITH_ONNXRUNTIME
+    LIBS += -lonnxruntime
+}
+onnxruntime_dnnl {
+    DEFINES += BIGBROTHER_WITH_ONNXRUNTIME_DNNL
+}
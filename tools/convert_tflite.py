@@ -0,0 +1,67 @@
+"""
+Converts the mask SavedModel to TensorFlow Lite, as float16 and as int8.
+
+The float16 file halves the weights and runs in float on the CPU. The int8 file
+is post-training quantized: a local calibration set of face crops is run
+through the model to pick the activation ranges. Its input and output stay
+float32 so TFLiteBackend feeds it the same 0-1 pixels as the SavedModel; pass
+--int8-io to quantize them too, TFLiteBackend then applies the scale and zero
+point itself.
+
+The calibration folder should hold a few hundred face crops (any size, they
+are resized to 150x150) from the cameras the model will run on, ideally with
+both masked and unmasked faces. They are fed in BGR order like the app does.
+
+usage: python3 convert_tflite.py mask-detect-009.model mask-detect-009 calibration/ [--int8-io]
+       writes mask-detect-009-fp16.tflite and mask-detect-009-int8.tflite
+"""
+import os
+import sys
+
+import numpy as np
+import tensorflow as tf
+
+IMG_SIZE = 150
+EXTENSIONS = ('.jpg', '.jpeg', '.png', '.bmp')
+
+
+def calibration_faces(folder, limit=500):
+    files = sorted(f for f in os.listdir(folder) if f.lower().endswith(EXTENSIONS))[:limit]
+    if not files:
+        raise SystemExit('no images in ' + folder)
+
+    for name in files:
+        image = tf.io.decode_image(tf.io.read_file(os.path.join(folder, name)), channels=3, expand_animations=False)
+        image = tf.image.resize(image, (IMG_SIZE, IMG_SIZE))
+        # decode_image gives RGB, the app hands the model OpenCV's BGR
+        image = image[..., ::-1] / 255.0
+        yield [np.expand_dims(image.numpy().astype(np.float32), 0)]
+
+
+def convert(saved_model, prefix, calibration, int8_io):
+    converter = tf.lite.TFLiteConverter.from_saved_model(saved_model)
+    converter.optimizations = [tf.lite.Optimize.DEFAULT]
+    converter.target_spec.supported_types = [tf.float16]
+    with open(prefix + '-fp16.tflite', 'wb') as f:
+        f.write(converter.convert())
+    print('wrote', prefix + '-fp16.tflite')
+
+    converter = tf.lite.TFLiteConverter.from_saved_model(saved_model)
+    converter.optimizations = [tf.lite.Optimize.DEFAULT]
+    converter.representative_dataset = lambda: calibration_faces(calibration)
+    converter.target_spec.supported_ops = [tf.lite.OpsSet.TFLITE_BUILTINS_INT8]
+    if int8_io:
+        converter.inference_input_type = tf.int8
+        converter.inference_output_type = tf.int8
+    with open(prefix + '-int8.tflite', 'wb') as f:
+        f.write(converter.convert())
+    print('wrote', prefix + '-int8.tflite')
+
+
+if __name__ == '__main__':
+    args = [a for a in sys.argv[1:] if a != '--int8-io']
+    if len(args) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    convert(args[0], args[1], args[2], '--int8-io' in sys.argv)
@@ -0,0 +1,47 @@
+"""
+Exports the serving signature of a SavedModel to ONNX.
+
+The input is transposed to NCHW inside the graph, so OpenCVBackend can feed it
+the blob from cv::dnn::blobFromImages as it is. OpenCV can also read the frozen
+graph from freeze_model.py; ONNX is the better supported of the two in recent
+OpenCV releases. Needs the tf2onnx package (pip install tf2onnx).
+
+Check the export against the SavedModel before deploying it:
+    ./bbtool parity - 0.001 mask-detect-009.model mask-detect-009.onnx@opencv
+
+usage: python3 export_onnx.py mask-detect-009.model mask-detect-009.onnx [opset]
+"""
+import sys
+
+import tensorflow as tf
+import tf2onnx
+
+
+def export(saved_model, output, opset):
+    model = tf.saved_model.load(saved_model)
+    signature = model.signatures['serving_default']
+
+    # the signature argument is the graph input, e.g. conv2d_input
+    argument = list(signature.structured_input_signature[1].keys())[0]
+    spec = signature.structured_input_signature[1][argument]
+
+    @tf.function(input_signature=[tf.TensorSpec(spec.shape, spec.dtype, name=argument)])
+    def serve(pixels):
+        return list(signature(**{argument: pixels}).values())[0]
+
+    tf2onnx.convert.from_function(
+        serve,
+        input_signature=serve.input_signature,
+        opset=opset,
+        inputs_as_nchw=[argument + ':0'],
+        output_path=output)
+
+    print('wrote', output)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) not in (3, 4):
+        print(__doc__)
+        sys.exit(1)
+
+    export(sys.argv[1], sys.argv[2], int(sys.argv[3]) if len(sys.argv) == 4 else 13)
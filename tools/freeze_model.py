@@ -0,0 +1,37 @@
+"""
+Freezes the serving signature of a SavedModel into a single binary GraphDef.
+
+The variables become constants, so cppflow::model(path, FROZEN_GRAPH) can load
+it without the variable restore that TF_LoadSessionFromSavedModel performs.
+
+usage: python3 freeze_model.py mask-detect-009.model mask-detect-009.pb
+"""
+import os
+import sys
+
+import tensorflow as tf
+from tensorflow.python.framework.convert_to_constants import convert_variables_to_constants_v2
+
+
+def freeze(saved_model, output):
+    model = tf.saved_model.load(saved_model)
+    signature = model.signatures['serving_default']
+
+    frozen = convert_variables_to_constants_v2(signature)
+    graph_def = frozen.graph.as_graph_def()
+
+    directory, name = os.path.split(os.path.abspath(output))
+    tf.io.write_graph(graph_def, directory, name, as_text=False)
+
+    # the app finds these itself, the placeholder is the input and the unconsumed tensor the output
+    print('wrote', output)
+    print('inputs: ', [t.name for t in frozen.inputs])
+    print('outputs:', [t.name for t in frozen.outputs])
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    freeze(sys.argv[1], sys.argv[2])
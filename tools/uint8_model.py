@@ -0,0 +1,40 @@
+"""
+Writes a copy of a SavedModel whose serving signature takes uint8 pixels.
+
+A Cast and a Mul(1/255) are added in front of the original signature, so the
+graph does the normalization MaskDetector used to do on the host and the app
+can hand TensorFlow the raw bytes of each face. Input and output names stay
+the same (serving_default_conv2d_input / StatefulPartitionedCall:0), and
+MaskDetector picks the input type up from the graph when it loads.
+
+usage: python3 uint8_model.py mask-detect-009.model mask-detect-009-uint8.model
+"""
+import sys
+
+import tensorflow as tf
+
+
+def convert(saved_model, output):
+    model = tf.saved_model.load(saved_model)
+    original = model.signatures['serving_default']
+
+    # keep the argument name of the original signature so the placeholder keeps its name
+    argument = list(original.structured_input_signature[1].keys())[0]
+    spec = original.structured_input_signature[1][argument]
+
+    @tf.function(input_signature=[tf.TensorSpec(spec.shape, tf.uint8, name=argument)])
+    def serve(pixels):
+        normalized = tf.cast(pixels, tf.float32) * (1.0 / 255.0)
+        return original(**{argument: normalized})
+
+    tf.saved_model.save(model, output, signatures={'serving_default': serve})
+
+    print('wrote', output)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    convert(sys.argv[1], sys.argv[2])